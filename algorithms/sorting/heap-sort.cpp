@@ -0,0 +1,58 @@
+/**
+ * Heapsort Demonstration in C++
+ *
+ * Sorts ints ascending and descending, with binary and 4-ary heaps, a
+ * deque (random-access but not contiguous), a vector<bool> (proxy
+ * references), and strings by length with a custom comparator.
+ */
+
+#include<deque>
+#include<functional>
+#include<iostream>
+#include<string>
+#include<vector>
+#include "heap-sort.hpp"
+using namespace std;
+
+template<typename T>
+void print(const string& label, const vector<T>& values) {
+    cout << label << ": [";
+    for (size_t i = 0; i < values.size(); ++i) {
+        cout << (i > 0 ? ", " : "") << values[i];
+    }
+    cout << "]" << endl;
+}
+
+int main() {
+    vector<int> values = {42, 7, 19, 3, 25, 7, 0, -4, 88, 19};
+    print("Input", values);
+
+    // Ascending with the default binary heap
+    vector<int> ascending = values;
+    heap_sort(ascending.begin(), ascending.end());
+    print("Ascending", ascending);
+
+    // Descending with a 4-ary heap
+    vector<int> descending = values;
+    heap_sort<4>(descending.begin(), descending.end(), greater<int>());
+    print("Descending (4-ary)", descending);
+
+    // Non-contiguous ranges work too; they skip the SIMD child scan
+    deque<int> queue(values.begin(), values.end());
+    heap_sort<4>(queue.begin(), queue.end());
+    print("Deque (4-ary)", vector<int>(queue.begin(), queue.end()));
+
+    // Proxy-reference ranges are sorted through their iterators as well
+    vector<bool> flags = {true, false, true, false, false, true};
+    heap_sort(flags.begin(), flags.end());
+    print("vector<bool>", flags);
+
+    // Any strict weak ordering works; equal keys may change order (not stable)
+    vector<string> words = {"heap", "sort", "in", "place", "a", "sift"};
+    heap_sort(words.begin(), words.end(), [](const string& a, const string& b) {
+        return a.size() < b.size();
+    });
+    print("Words by length", words);
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * Heapsort in C++
+ *
+ * In-place, allocation-free sort built on the heap sift kernels
+ * (data-structures/heap/heap-sift.hpp):
+ * - Build a heap over the range whose top is the element that sorts last
+ *   (a max-heap for std::less), with Floyd's O(n) build
+ * - Repeatedly swap the top with the last element of the heap and shrink
+ *   the heap by one; the element moved to the top came from the bottom, so
+ *   it is sifted down bottom-up (one comparison per level on the way down,
+ *   a short climb back)
+ *
+ * Arity picks the children per node: wider heaps are shallower and touch
+ * fewer cache lines per sift at the cost of more comparisons per level.
+ * Arithmetic ranges (32/64-bit integers, float, double) sorted with
+ * std::less/std::greater and Arity 4, 8 or 16 pick the winning child with
+ * the SIMD kernel, like DaryHeap. The kernel loads whole sibling groups, so
+ * contiguous ranges (pointers, vector iterators, and any
+ * std::contiguous_iterator under C++20) are sorted through a raw pointer;
+ * other random-access ranges (deque, vector<bool>, ...) take the scalar loop.
+ *
+ * Not stable. Needs random-access iterators and a move-assignable value type.
+ *
+ * Time Complexities:
+ * - Best, average and worst case: O(n log n)
+ *
+ * Space Complexity: O(1)
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<functional>
+#include<iterator>
+#include<memory>
+#include<type_traits>
+#include<utility>
+#include<vector>
+#include "../../data-structures/heap/heap-sift.hpp"
+
+namespace heap_sort_detail {
+
+    /**
+     * Heap order for sorting with comp: comp(a, b) means a comes first, so
+     * b must sit above a. std::less/std::greater map onto each other to keep
+     * the SIMD child selection of the sift kernels.
+     */
+    template<typename Compare>
+    struct Reversed {
+        Compare& comp;
+
+        template<typename T>
+        bool operator()(const T& a, const T& b) {
+            return comp(b, a);
+        }
+    };
+
+    template<typename Compare>
+    struct HeapOrder {
+        using type = Reversed<Compare>;
+
+        static type make(Compare& comp) {
+            return type{comp};
+        }
+    };
+
+    template<typename T>
+    struct HeapOrder<std::less<T>> {
+        using type = std::greater<T>;
+
+        static type make(std::less<T>&) {
+            return type();
+        }
+    };
+
+    template<typename T>
+    struct HeapOrder<std::greater<T>> {
+        using type = std::less<T>;
+
+        static type make(std::greater<T>&) {
+            return type();
+        }
+    };
+
+    /**
+     * Whether RandomIt is known to address adjacent elements in memory
+     */
+    template<typename RandomIt>
+    constexpr bool isContiguous() {
+#if __cplusplus >= 202002L
+        return std::contiguous_iterator<RandomIt>;
+#else
+        using T = typename std::iterator_traits<RandomIt>::value_type;
+        using Reference = typename std::iterator_traits<RandomIt>::reference;
+        return std::is_pointer_v<RandomIt> ||
+               (std::is_same_v<RandomIt, typename std::vector<T>::iterator> && std::is_same_v<Reference, T&>);
+#endif
+    }
+
+    template<std::size_t Arity, typename RandomIt, typename Compare>
+    void sort(RandomIt first, std::size_t size, Compare& comp) {
+        auto order = HeapOrder<Compare>::make(comp);
+
+        heap_sift::heapify<Arity>(first, size, order);
+        while (size > 1) {
+            --size;
+            // Last leaf leaves the heap (as a value: a proxy reference would
+            // alias the slot written next)...
+            typename std::iterator_traits<RandomIt>::value_type value = std::move(first[size]);
+            first[size] = std::move(first[0]);    // ...the top takes its slot
+            heap_sift::siftDownBottomUp<Arity>(first, size, 0, std::move(value), order);
+        }
+    }
+
+}  // namespace heap_sort_detail
+
+/**
+ * Sort [first, last) in place so that comp holds between neighbours
+ * @param first, last: Random-access range to sort
+ * @param comp: Strict weak ordering; comp(a, b) == true means a comes before b
+ */
+template<std::size_t Arity = 2, typename RandomIt, typename Compare>
+void heap_sort(RandomIt first, RandomIt last, Compare comp) {
+    static_assert(Arity >= 2, "A heap node needs at least two children");
+
+    std::size_t size = static_cast<std::size_t>(last - first);
+    if (size < 2) {
+        return;
+    }
+    if constexpr (heap_sort_detail::isContiguous<RandomIt>()) {
+        heap_sort_detail::sort<Arity>(std::addressof(*first), size, comp);
+    } else {
+        heap_sort_detail::sort<Arity>(first, size, comp);
+    }
+}
+
+/**
+ * Sort [first, last) in ascending order
+ * @param first, last: Random-access range to sort
+ */
+template<std::size_t Arity = 2, typename RandomIt>
+void heap_sort(RandomIt first, RandomIt last) {
+    heap_sort<Arity>(first, last, std::less<typename std::iterator_traits<RandomIt>::value_type>());
+}
@@ -0,0 +1,55 @@
+/**
+ * AddressableHeap Demonstration in C++
+ *
+ * Runs Dijkstra's shortest paths on a small graph. Every vertex is pushed
+ * once; when a shorter path is found its key is lowered in place with
+ * decrease_key instead of pushing a duplicate entry.
+ */
+
+#include<iostream>
+#include<climits>
+#include<vector>
+#include "addressable-heap.hpp"
+using namespace std;
+
+int main() {
+    // Weighted directed graph as adjacency lists of (target, weight)
+    vector<vector<pair<int, int>>> graph = {
+        {{1, 4}, {2, 1}},   // 0
+        {{3, 1}},           // 1
+        {{1, 2}, {3, 5}},   // 2
+        {{4, 3}},           // 3
+        {}                  // 4
+    };
+    const int vertices = static_cast<int>(graph.size());
+
+    // Keys are (distance, vertex) pairs; every vertex gets one handle
+    AddressableHeap<pair<int, int>> queue(vertices);
+    vector<AddressableHeap<pair<int, int>>::Handle> handle(vertices);
+    vector<int> distance(vertices, INT_MAX);
+    distance[0] = 0;
+    for (int v = 0; v < vertices; ++v) {
+        handle[v] = queue.push({distance[v], v});
+    }
+
+    while (!queue.empty()) {
+        auto [dist, u] = queue.pop();
+        if (dist == INT_MAX) {
+            break;  // Remaining vertices are unreachable
+        }
+        for (auto [v, weight] : graph[u]) {
+            if (queue.contains(handle[v]) && dist + weight < distance[v]) {
+                distance[v] = dist + weight;
+                queue.decrease_key(handle[v], {distance[v], v});
+                cout << "Lowered vertex " << v << " to " << distance[v] << endl;
+            }
+        }
+    }
+
+    cout << "Shortest distances from vertex 0:";
+    for (int v = 0; v < vertices; ++v) {
+        cout << ' ' << distance[v];
+    }
+    cout << endl;
+    return 0;
+}
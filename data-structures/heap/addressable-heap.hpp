@@ -0,0 +1,329 @@
+/**
+ * Addressable Heap Implementation in C++
+ *
+ * A d-ary heap (binary by default) whose elements stay reachable after
+ * insertion: push returns a stable handle, and the handle can later be used
+ * to change the element's key or to remove it, so callers like Dijkstra or a
+ * scheduler never have to re-insert duplicates and filter stale entries.
+ *
+ * - decrease_key(h, k): k moves the element towards the top (sift up)
+ * - increase_key(h, k): k moves the element away from the top (sift down)
+ * - update(h, k):       either direction, decided by comparing with the old key
+ * - erase(h):           remove the element wherever it is
+ *
+ * "decrease" and "increase" follow the min-heap convention: with
+ * std::greater (a max-heap) decrease_key means the key grows.
+ *
+ * Handles index a flat position table (position[handle] = slot), which the
+ * shared sift kernels keep current through their placement callback, inside
+ * the sift loops. A handle becomes invalid once its element is popped or
+ * erased, and may be reused by a later push; contains(h) tells them apart
+ * from live handles only until that reuse.
+ *
+ * Time Complexities:
+ * - push / pop / decrease_key / increase_key / update / erase: O(log n)
+ * - peek / top / value / contains: O(1)
+ *
+ * Space Complexity: O(n) plus one position slot per handle ever live at once
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<functional>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<utility>
+#include<vector>
+#include "aligned-allocator.hpp"
+#include "heap-sift.hpp"
+
+template<typename T, typename Compare = std::less<T>, std::size_t Arity = 2>
+class AddressableHeap {
+    static_assert(Arity >= 2, "A heap node needs at least two children");
+
+    public:
+        using Handle = std::size_t;
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    private:
+        static constexpr std::size_t root = Arity - 1;  // Same layout as Heap
+
+        struct Entry {
+            T value;
+            Handle handle;
+        };
+
+        /**
+         * Orders entries by their values
+         */
+        struct EntryCompare {
+            Compare comp;
+
+            bool operator()(const Entry& a, const Entry& b) const {
+                return comp(a.value, b.value);
+            }
+        };
+
+        std::vector<Entry, CacheAlignedAllocator<Entry>> heap;  // Entries, starting at index root
+        std::vector<std::size_t> position;                      // Slot of each handle, npos if free
+        std::vector<Handle> freeHandles;                        // Handles ready for reuse
+        EntryCompare comp;
+
+        typename std::vector<Entry, CacheAlignedAllocator<Entry>>::iterator data() {
+            return heap.begin() + root;
+        }
+
+        /**
+         * Placement callback for the sift kernels: records where each entry lands
+         */
+        auto tracker() {
+            auto base = data();
+            std::size_t* slots = position.data();
+            return [base, slots](std::size_t index) {
+                slots[base[index].handle] = index;
+            };
+        }
+
+        Handle acquireHandle() {
+            if (!freeHandles.empty()) {
+                Handle handle = freeHandles.back();
+                freeHandles.pop_back();
+                return handle;
+            }
+            position.push_back(npos);
+            return position.size() - 1;
+        }
+
+        void releaseHandle(Handle handle) {
+            position[handle] = npos;
+            freeHandles.push_back(handle);
+        }
+
+        /**
+         * Move the entry at index up or down until the heap property holds
+         */
+        void restore(std::size_t index) {
+            if (index > 0 && comp(data()[index], data()[heap_sift::parentOf<Arity>(index)])) {
+                heap_sift::siftUp<Arity>(data(), index, std::move(data()[index]), comp, tracker());
+            } else {
+                heap_sift::siftDown<Arity>(data(), size(), index, std::move(data()[index]), comp, tracker());
+            }
+        }
+
+        /**
+         * Remove the entry at index and return its value
+         */
+        T removeAt(std::size_t index) {
+            Entry removed = std::move(data()[index]);
+            releaseHandle(removed.handle);
+
+            Entry last = std::move(heap.back());
+            heap.pop_back();
+            if (index < size()) {
+                data()[index] = std::move(last);
+                position[data()[index].handle] = index;
+                restore(index);
+            }
+            return std::move(removed.value);
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty heap
+         * @param capacity: Number of elements to reserve room for
+         * @param compare: Ordering used to arrange the elements
+         */
+        explicit AddressableHeap(std::size_t capacity = 0, const Compare& compare = Compare())
+            : comp{compare} {
+            heap.reserve(capacity + root);
+            heap.resize(root);
+            position.reserve(capacity);
+        }
+
+        /**
+         * Insert an element
+         * @param element: Value to be added to the heap
+         * @return: Handle identifying the element until it is popped or erased
+         */
+        Handle push(T element) {
+            Handle handle = acquireHandle();
+            heap.push_back(Entry{std::move(element), handle});
+            heap_sift::siftUp<Arity>(data(), size() - 1, std::move(heap.back()), comp, tracker());
+            return handle;
+        }
+
+        /**
+         * Construct an element in place and insert it
+         * @param args: Constructor arguments for T
+         * @return: Handle identifying the element until it is popped or erased
+         */
+        template<typename... Args>
+        Handle emplace(Args&&... args) {
+            return push(T(std::forward<Args>(args)...));
+        }
+
+        /**
+         * Insert an element, for API parity with Heap (the handle is discarded)
+         * @return: Always true; an addressable heap is never full
+         */
+        bool add(const T& element) {
+            push(element);
+            return true;
+        }
+
+        /**
+         * Change the key of an element to one that does not lose against the
+         * current key, moving it towards the top
+         * @param handle: Live handle returned by push
+         * @param key: New value
+         */
+        void decrease_key(Handle handle, T key) {
+            std::size_t index = position[handle];
+            data()[index].value = std::move(key);
+            heap_sift::siftUp<Arity>(data(), index, std::move(data()[index]), comp, tracker());
+        }
+
+        /**
+         * Change the key of an element to one that does not beat the current
+         * key, moving it away from the top
+         * @param handle: Live handle returned by push
+         * @param key: New value
+         */
+        void increase_key(Handle handle, T key) {
+            std::size_t index = position[handle];
+            data()[index].value = std::move(key);
+            heap_sift::siftDown<Arity>(data(), size(), index, std::move(data()[index]), comp, tracker());
+        }
+
+        /**
+         * Change the key of an element in either direction
+         * @param handle: Live handle returned by push
+         * @param key: New value
+         */
+        void update(Handle handle, T key) {
+            std::size_t index = position[handle];
+            data()[index].value = std::move(key);
+            restore(index);
+        }
+
+        /**
+         * Remove an element wherever it sits in the heap
+         * @param handle: Live handle returned by push
+         * @return: The removed value
+         */
+        T erase(Handle handle) {
+            return removeAt(position[handle]);
+        }
+
+        /**
+         * Check whether a handle refers to an element currently in the heap
+         */
+        bool contains(Handle handle) const {
+            return handle < position.size() && position[handle] != npos;
+        }
+
+        /**
+         * Value of the element behind a live handle
+         */
+        const T& value(Handle handle) const {
+            return heap[root + position[handle]].value;
+        }
+
+        /**
+         * Access the top element in place
+         * Precondition: the heap is not empty
+         */
+        const T& top() const {
+            return heap[root].value;
+        }
+
+        /**
+         * Handle of the top element
+         * Precondition: the heap is not empty
+         */
+        Handle top_handle() const {
+            return heap[root].handle;
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The top element, or the empty sentinel if empty
+         */
+        T peek() const {
+            if (empty()) {
+                return heap_sift::emptyValue<T>(comp.comp);
+            }
+            return top();
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The top element, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_peek() const {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return top();
+        }
+
+        /**
+         * Remove and return the top element; its handle becomes invalid
+         * @return: The element that was removed, or the empty sentinel if empty
+         */
+        T pop() {
+            if (empty()) {
+                return heap_sift::emptyValue<T>(comp.comp);
+            }
+            return removeAt(0);
+        }
+
+        /**
+         * Remove and return the top element; its handle becomes invalid
+         * @return: The element that was removed, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_pop() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeAt(0);
+        }
+
+        /**
+         * Get the current number of elements in the heap
+         */
+        std::size_t size() const {
+            return heap.size() - root;
+        }
+
+        /**
+         * Check whether the heap holds no elements
+         */
+        bool empty() const {
+            return heap.size() == root;
+        }
+
+        /**
+         * Convert heap to string representation for display (level order)
+         * Requires T to support operator<<
+         */
+        std::string toString() const {
+            if (empty()) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            oss << '[';
+            for (std::size_t i = root; i < heap.size(); ++i) {
+                oss << heap[i].value;
+                if (i + 1 < heap.size()) {
+                    oss << ',';
+                }
+            }
+            oss << ']';
+            return oss.str();
+        }
+};
@@ -0,0 +1,157 @@
+/**
+ * Shared helpers for the heap benchmarks
+ *
+ * - readCycles(): cycle counter (TSC on x86, steady_clock nanoseconds elsewhere)
+ * - doNotOptimize(): keeps the optimizer from deleting unused results
+ * - BenchRandom: small, fast xorshift64* generator for reproducible inputs
+ * - Record<Bytes>: fixed-size payload keyed by a 64-bit integer
+ * - benchSizes(): heap sizes from the command line, or the defaults
+ * - addPopCycles(): average cost of add and pop over a fill/drain cycle
+ *
+ * Build the benchmarks with optimizations, e.g.
+ *   g++ -std=c++17 -O3 -march=native sift-bench.cpp -o sift-bench
+ */
+
+#pragma once
+
+#include<chrono>
+#include<cstddef>
+#include<cstdint>
+#include<cstdlib>
+#include<initializer_list>
+#include<ostream>
+#include<utility>
+#include<vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include<x86intrin.h>
+#endif
+
+/**
+ * Read the cycle counter used to report per-operation costs
+ * @return: Elapsed TSC cycles on x86, or nanoseconds on other targets
+ */
+inline std::uint64_t readCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/**
+ * Unit reported by readCycles(), for table headers
+ */
+inline const char* cycleUnit() {
+#if defined(__x86_64__) || defined(__i386__)
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+/**
+ * Force value to be materialised so the computation producing it is kept
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * xorshift64* generator: fast enough not to dominate the measured loops
+ */
+struct BenchRandom {
+    std::uint64_t state;
+
+    explicit BenchRandom(std::uint64_t seed = 0x9E3779B97F4A7C15ull) : state(seed | 1) {}
+
+    std::uint64_t next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1Dull;
+    }
+};
+
+/**
+ * Fixed-size element keyed by a 64-bit integer, used to measure how the
+ * cost of moving elements scales with their size
+ */
+template<std::size_t Bytes>
+struct Record {
+    static_assert(Bytes >= sizeof(std::uint64_t), "Record must hold its key");
+
+    std::uint64_t key = 0;
+    unsigned char payload[Bytes - sizeof(std::uint64_t)] = {};
+
+    Record() = default;
+    Record(std::uint64_t k) : key(k) {}
+
+    friend bool operator<(const Record& a, const Record& b) { return a.key < b.key; }
+    friend bool operator>(const Record& a, const Record& b) { return a.key > b.key; }
+    friend std::ostream& operator<<(std::ostream& os, const Record& r) { return os << r.key; }
+};
+
+/**
+ * Sizes to benchmark: every command-line argument parsed as a count,
+ * or the given defaults when none are passed
+ */
+inline std::vector<std::size_t> benchSizes(int argc, char** argv,
+                                           std::initializer_list<std::size_t> defaults) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes.assign(defaults.begin(), defaults.end());
+    }
+    return sizes;
+}
+
+/**
+ * Number of times to repeat a run over n elements so that small sizes
+ * still execute about `target` operations in total
+ */
+inline std::size_t benchRounds(std::size_t n, std::size_t target = 10000000) {
+    return n >= target ? 1 : (target + n - 1) / n;
+}
+
+/**
+ * Fill a heap with n random elements through add, then drain it with pop
+ * HeapT must be constructible from a capacity and expose add/pop
+ * @return: Average cycles per add and per pop
+ */
+template<typename HeapT, typename T>
+std::pair<double, double> addPopCycles(std::size_t n) {
+    const std::size_t rounds = benchRounds(n);
+    std::uint64_t addCycles = 0;
+    std::uint64_t popCycles = 0;
+
+    for (std::size_t r = 0; r < rounds; ++r) {
+        BenchRandom rng(r + 1);
+        HeapT heap(n);
+
+        std::uint64_t start = readCycles();
+        for (std::size_t i = 0; i < n; ++i) {
+            heap.add(T(rng.next() >> 1));
+        }
+        std::uint64_t middle = readCycles();
+        for (std::size_t i = 0; i < n; ++i) {
+            doNotOptimize(heap.pop());
+        }
+        std::uint64_t end = readCycles();
+
+        addCycles += middle - start;
+        popCycles += end - middle;
+    }
+
+    double ops = static_cast<double>(n) * rounds;
+    return {addCycles / ops, popCycles / ops};
+}
@@ -0,0 +1,91 @@
+/**
+ * Bulk Operations Benchmark: push_bulk/pop_n vs loops of add/pop
+ *
+ * Starting from a heap of n random ints, repeatedly pushes a batch of k
+ * elements and pops k elements again (so the heap stays at n), once with
+ * single-element calls and once with the batch APIs. Prints cycles per
+ * element for every batch size, showing where push_bulk switches from
+ * per-element sift-up to re-heapifying the ancestors of the batch.
+ *
+ * Usage: bulk-bench [sizes...]   (default: 1000000; batches 16 .. n)
+ * Build: g++ -std=c++17 -O3 -march=native bulk-bench.cpp -o bulk-bench
+ */
+
+#include<cstdio>
+#include<iterator>
+#include<vector>
+#include "../heap.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+struct BulkResult {
+    double addLoop, pushBulk, popLoop, popN;
+};
+
+BulkResult measure(size_t n, size_t k) {
+    BenchRandom rng(11);
+    vector<int> base(n);
+    for (int& value : base) {
+        value = static_cast<int>(rng.next() >> 33);
+    }
+    vector<int> batch(k);
+    vector<int> out;
+    out.reserve(k);
+
+    const size_t rounds = benchRounds(k, 4000000);
+    uint64_t addLoop = 0, pushBulk = 0, popLoop = 0, popN = 0;
+
+    MinHeap single(base.begin(), base.end());
+    MinHeap bulk(base.begin(), base.end());
+    for (size_t r = 0; r < rounds; ++r) {
+        for (int& value : batch) {
+            value = static_cast<int>(rng.next() >> 33);
+        }
+
+        out.clear();
+        uint64_t start = readCycles();
+        for (int value : batch) {
+            single.add(value);
+        }
+        uint64_t middle = readCycles();
+        for (size_t i = 0; i < k; ++i) {
+            out.push_back(single.pop());
+        }
+        uint64_t end = readCycles();
+        doNotOptimize(out.back());
+        addLoop += middle - start;
+        popLoop += end - middle;
+
+        out.clear();
+        start = readCycles();
+        bulk.push_bulk(batch.begin(), batch.end());
+        middle = readCycles();
+        bulk.pop_n(k, back_inserter(out));
+        end = readCycles();
+        doNotOptimize(out.back());
+        pushBulk += middle - start;
+        popN += end - middle;
+    }
+
+    double ops = static_cast<double>(k) * rounds;
+    return {addLoop / ops, pushBulk / ops, popLoop / ops, popN / ops};
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {1000000});
+
+    printf("%12s  %10s  %10s  %10s  %10s  %10s\n", "elements", "batch", "add loop", "push_bulk",
+           "pop loop", "pop_n");
+    printf("(%s per element)\n", cycleUnit());
+    for (size_t n : sizes) {
+        for (size_t k : {size_t(16), size_t(1024), size_t(65536), n}) {
+            if (k > n) {
+                continue;
+            }
+            BulkResult result = measure(n, k);
+            printf("%12zu  %10zu  %10.1f  %10.1f  %10.1f  %10.1f\n", n, k,
+                   result.addLoop, result.pushBulk, result.popLoop, result.popN);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * Concurrent Heap Benchmark: per-slot locks vs one mutex
+ *
+ * Throughput of a shared priority queue as threads are added:
+ * - mutex:      MinHeap behind a single std::mutex (what services do today)
+ * - per-slot:   ConcurrentMinHeap (Hunt et al. per-slot locks)
+ * The heap starts with 100000 random ints; every thread then runs an equal
+ * share of 4M operations, half add and half pop, chosen at random.
+ * Reported in million operations per second of wall-clock time.
+ *
+ * Usage: concurrent-bench [thread counts...]   (default: 1 2 4 8 16 32 64)
+ * Build: g++ -std=c++17 -O3 -march=native -pthread concurrent-bench.cpp -o concurrent-bench
+ */
+
+#include<atomic>
+#include<chrono>
+#include<cstdint>
+#include<cstdio>
+#include<mutex>
+#include<optional>
+#include<thread>
+#include<vector>
+#include "../concurrent-heap.hpp"
+#include "../heap.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+/**
+ * MinHeap with every operation under one mutex
+ */
+class LockedMinHeap {
+    private:
+        MinHeap heap;
+        mutex lock;
+
+    public:
+        explicit LockedMinHeap(size_t capacity) : heap(capacity) {}
+
+        bool add(int value) {
+            lock_guard<mutex> guard(lock);
+            return heap.add(value);
+        }
+
+        optional<int> try_pop() {
+            lock_guard<mutex> guard(lock);
+            return heap.try_pop();
+        }
+};
+
+/**
+ * Million operations per second with the given number of threads
+ */
+template<typename Queue>
+double throughput(size_t threads) {
+    const size_t prefill = 100000;
+    const size_t ops = 4000000;
+
+    Queue queue(prefill * 2);
+    BenchRandom fill(41);
+    for (size_t i = 0; i < prefill; ++i) {
+        queue.add(static_cast<int>(fill.next() >> 33));
+    }
+
+    atomic<bool> go{false};
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&queue, &go, t, threads, ops]() {
+            BenchRandom rng(1000 + t);
+            while (!go.load(memory_order_acquire)) {
+                this_thread::yield();
+            }
+            for (size_t i = t; i < ops; i += threads) {
+                uint64_t r = rng.next();
+                if (r & 1) {
+                    queue.add(static_cast<int>(r >> 33));
+                } else {
+                    doNotOptimize(queue.try_pop());
+                }
+            }
+        });
+    }
+
+    auto start = chrono::steady_clock::now();
+    go.store(true, memory_order_release);
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return ops / elapsed.count() / 1e6;
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> threadCounts = benchSizes(argc, argv, {1, 2, 4, 8, 16, 32, 64});
+
+    printf("%8s  %12s  %12s\n", "threads", "mutex", "per-slot");
+    printf("(million operations per second; %u hardware threads)\n", thread::hardware_concurrency());
+    for (size_t threads : threadCounts) {
+        printf("%8zu  %12.2f  %12.2f\n", threads, throughput<LockedMinHeap>(threads),
+               throughput<ConcurrentMinHeap>(threads));
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+/**
+ * d-ary Heap Benchmark: arity x heap size x element size
+ *
+ * For every combination prints cycles per add and per pop, so the arity can
+ * be chosen per workload. Wider nodes shorten the tree (fewer cache misses
+ * per pop once the heap outgrows L2) but cost Arity-1 comparisons per level,
+ * and only pay off while a sibling group still fits one 64-byte line.
+ *
+ * Arity:        2, 4, 8
+ * Element size: 4 bytes (int), 16 bytes, 64 bytes (Record<Bytes>)
+ *
+ * Usage: dary-bench [sizes...]   (default: 1000 1000000 10000000)
+ * Build: g++ -std=c++17 -O3 -march=native dary-bench.cpp -o dary-bench
+ */
+
+#include<cstdio>
+#include<vector>
+#include "../heap.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+template<typename T>
+void runElement(const char* typeName, size_t n) {
+    pair<double, double> binary = addPopCycles<DaryHeap<T, 2>, T>(n);
+    pair<double, double> quad = addPopCycles<DaryHeap<T, 4>, T>(n);
+    pair<double, double> octo = addPopCycles<DaryHeap<T, 8>, T>(n);
+    printf("%12zu  %-9s  add  %9.1f  %9.1f  %9.1f\n",
+           n, typeName, binary.first, quad.first, octo.first);
+    printf("%12zu  %-9s  pop  %9.1f  %9.1f  %9.1f\n",
+           n, typeName, binary.second, quad.second, octo.second);
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {1000, 1000000, 10000000});
+
+    printf("%12s  %-9s  %-3s  %9s  %9s  %9s\n", "elements", "element", "op", "D=2", "D=4", "D=8");
+    printf("(%s per operation)\n", cycleUnit());
+    for (size_t n : sizes) {
+        runElement<int>("4 bytes", n);
+        runElement<Record<16>>("16 bytes", n);
+        runElement<Record<64>>("64 bytes", n);
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * Dense Dijkstra Benchmark: where does a Fibonacci heap beat d-ary heaps?
+ *
+ * On a dense graph (E ~ V^2) most of the work of Dijkstra is relaxing edges,
+ * and a relaxation that improves a tentative distance is a decrease-key.
+ * That is the one operation the Fibonacci heap makes O(1) amortized, so
+ * this is the setting where it should pay off, if anywhere. Queues:
+ * - array scan:        no heap at all, O(V^2) scans for the closest vertex
+ *                      (the classic answer for dense graphs)
+ * - binary (lazy):     Heap of (dist, vertex) without decrease-key
+ * - d-ary (indexed):   IndexedMinHeap with 2, 4 and 8 children per node
+ * - pairing:           PairingHeap, O(1) decrease_key by cutting
+ * - fibonacci:         FibonacciHeap, pooled nodes, cascading cuts
+ *
+ * Complete directed graphs:
+ * - random:      weights uniform in [1, 1000]; only ~ln V decrease-keys per vertex
+ * - adversarial: weights chosen so that every settled vertex improves the
+ *                distance of all later vertices: ~V/2 decrease-keys per vertex
+ *
+ * Usage: dense-dijkstra-bench [vertices...]   (default: 1000 3000)
+ * Build: g++ -std=c++17 -O3 -march=native dense-dijkstra-bench.cpp -o dense-dijkstra-bench
+ */
+
+#include<cstdint>
+#include<cstdio>
+#include<utility>
+#include<vector>
+#include "../fibonacci-heap.hpp"
+#include "../pairing-heap.hpp"
+#include "bench-common.hpp"
+#include "dijkstra-common.hpp"
+using namespace std;
+
+Graph randomDenseGraph(int vertices) {
+    BenchRandom rng(17);
+    return buildGraph(vertices, [vertices, &rng](int u, auto emit) {
+        for (int v = 0; v < vertices; ++v) {
+            if (v != u) {
+                emit(v, 1 + rng.next() % 1000);
+            }
+        }
+    });
+}
+
+/**
+ * dist(v) = v along the chain 0 -> 1 -> ... but every earlier vertex u
+ * offers v a path of length 4V - u, improving on all earlier offers
+ */
+Graph adversarialDenseGraph(int vertices) {
+    const uint32_t big = 4 * static_cast<uint32_t>(vertices);
+    return buildGraph(vertices, [vertices, big](int u, auto emit) {
+        for (int v = 0; v < vertices; ++v) {
+            if (v == u + 1) {
+                emit(v, 1);
+            } else if (v > u + 1) {
+                emit(v, big - 2 * static_cast<uint32_t>(u));
+            } else if (v != u) {
+                emit(v, 2 * big);
+            }
+        }
+    });
+}
+
+/**
+ * Dijkstra without a heap: scan all unsettled vertices for the closest one
+ * @param decreases: If not null, receives the number of improving relaxations
+ */
+vector<uint64_t> dijkstraArrayScan(const Graph& graph, int source, size_t* decreases = nullptr) {
+    const int vertices = graph.vertices();
+    vector<uint64_t> distance(vertices, unreached);
+    vector<bool> settled(vertices, false);
+    size_t improved = 0;
+    distance[source] = 0;
+    for (int round = 0; round < vertices; ++round) {
+        int u = -1;
+        for (int v = 0; v < vertices; ++v) {
+            if (!settled[v] && distance[v] != unreached && (u == -1 || distance[v] < distance[u])) {
+                u = v;
+            }
+        }
+        if (u == -1) {
+            break;
+        }
+        settled[u] = true;
+        for (size_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+            int v = graph.targets[e];
+            uint64_t candidate = distance[u] + graph.weights[e];
+            if (candidate < distance[v]) {
+                improved += distance[v] != unreached;
+                distance[v] = candidate;
+            }
+        }
+    }
+    if (decreases != nullptr) {
+        *decreases = improved;
+    }
+    return distance;
+}
+
+void runGraph(const char* shape, const Graph& graph) {
+    size_t decreases = 0;
+    dijkstraArrayScan(graph, 0, &decreases);
+    printf("%12d  %-11s  (%zu edges, %.1f decrease-keys per vertex)\n", graph.vertices(), shape,
+           graph.targets.size(), static_cast<double>(decreases) / graph.vertices());
+
+    using Entry = pair<uint64_t, int>;
+    measureDijkstra("array scan", graph, [](const Graph& g, int source) { return dijkstraArrayScan(g, source); });
+    measureDijkstra("binary (lazy)", graph, dijkstraLazy<>);
+    measureDijkstra("2-ary (indexed)", graph, dijkstraIndexed<2>);
+    measureDijkstra("4-ary (indexed)", graph, dijkstraIndexed<4>);
+    measureDijkstra("8-ary (indexed)", graph, dijkstraIndexed<8>);
+    measureDijkstra("pairing", graph, dijkstraHandles<PairingHeap<Entry>>);
+    measureDijkstra("fibonacci", graph, dijkstraHandles<FibonacciHeap<Entry>>);
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {1000, 3000});
+
+    printf("%12s  %-11s  %-17s  %12s  %20s\n", "vertices", "graph", "queue", "cyc/vertex", "checksum");
+    printf("(%s per vertex for one full shortest-path run)\n", cycleUnit());
+    for (size_t n : sizes) {
+        runGraph("random", randomDenseGraph(static_cast<int>(n)));
+        runGraph("adversarial", adversarialDenseGraph(static_cast<int>(n)));
+    }
+    return 0;
+}
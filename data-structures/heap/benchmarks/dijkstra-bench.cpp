@@ -0,0 +1,79 @@
+/**
+ * Dijkstra Benchmark: binary heap vs pointer-based heaps on sparse graphs
+ *
+ * Runs single-source shortest paths with five priority queues:
+ * - binary (lazy):     Heap<(dist, vertex)>; every relaxation pushes a new
+ *                      entry and stale entries are skipped when popped,
+ *                      which is how MinHeap is used without decrease-key
+ * - binary (indexed):  IndexedMinHeap; relaxations call change_priority,
+ *                      an O(log n) sift-up
+ * - radix (lazy):      RadixHeap<(dist, vertex)>, lazy like the binary heap;
+ *                      distances popped by Dijkstra never decrease
+ * - pairing:           PairingHeap; relaxations call decrease_key, an O(1) cut
+ * - fibonacci:         FibonacciHeap; decrease_key is a cut plus cascading cuts
+ *
+ * Graphs, both with random edge weights in [1, 1000]:
+ * - grid:   square 4-neighbour grid, the usual stand-in for a road network
+ * - random: 8 random out-edges per vertex
+ *
+ * Every queue must produce the same distances; the checksum column shows it.
+ * Dense graphs, where decrease-key dominates, are in dense-dijkstra-bench.cpp.
+ *
+ * Usage: dijkstra-bench [vertices...]   (default: 10000 1000000)
+ * Build: g++ -std=c++17 -O3 -march=native dijkstra-bench.cpp -o dijkstra-bench
+ */
+
+#include<cmath>
+#include<cstdint>
+#include<cstdio>
+#include<utility>
+#include<vector>
+#include "../fibonacci-heap.hpp"
+#include "../pairing-heap.hpp"
+#include "../radix-heap.hpp"
+#include "bench-common.hpp"
+#include "dijkstra-common.hpp"
+using namespace std;
+
+Graph gridGraph(int vertices) {
+    const int side = static_cast<int>(sqrt(static_cast<double>(vertices)));
+    BenchRandom rng(11);
+    return buildGraph(side * side, [side, &rng](int u, auto emit) {
+        const int row = u / side;
+        const int col = u % side;
+        if (row > 0) emit(u - side, 1 + rng.next() % 1000);
+        if (row + 1 < side) emit(u + side, 1 + rng.next() % 1000);
+        if (col > 0) emit(u - 1, 1 + rng.next() % 1000);
+        if (col + 1 < side) emit(u + 1, 1 + rng.next() % 1000);
+    });
+}
+
+Graph randomGraph(int vertices) {
+    BenchRandom rng(13);
+    return buildGraph(vertices, [vertices, &rng](int, auto emit) {
+        for (int e = 0; e < 8; ++e) {
+            emit(static_cast<int>(rng.next() % vertices), 1 + rng.next() % 1000);
+        }
+    });
+}
+
+void runGraph(const char* shape, const Graph& graph) {
+    printf("%12d  %-11s  (%zu edges)\n", graph.vertices(), shape, graph.targets.size());
+    measureDijkstra("binary (lazy)", graph, dijkstraLazy<>);
+    measureDijkstra("binary (indexed)", graph, dijkstraIndexed<2>);
+    measureDijkstra("radix (lazy)", graph, dijkstraLazy<RadixHeap<uint64_t, int>>);
+    measureDijkstra("pairing", graph, dijkstraHandles<PairingHeap<pair<uint64_t, int>>>);
+    measureDijkstra("fibonacci", graph, dijkstraHandles<FibonacciHeap<pair<uint64_t, int>>>);
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {10000, 1000000});
+
+    printf("%12s  %-11s  %-17s  %12s  %20s\n", "vertices", "graph", "queue", "cyc/vertex", "checksum");
+    printf("(%s per vertex for one full shortest-path run)\n", cycleUnit());
+    for (size_t n : sizes) {
+        runGraph("grid", gridGraph(static_cast<int>(n)));
+        runGraph("random", randomGraph(static_cast<int>(n)));
+    }
+    return 0;
+}
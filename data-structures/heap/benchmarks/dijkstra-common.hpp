@@ -0,0 +1,166 @@
+/**
+ * Shared pieces of the shortest-path benchmarks
+ *
+ * - Graph / buildGraph(): directed graph in compressed sparse row form
+ * - dijkstraLazy():       no decrease-key; push duplicates, skip stale entries
+ * - dijkstraIndexed():    IndexedMinHeap of any arity, change_priority
+ * - dijkstraHandles():    any heap with handles and decrease_key
+ *                         (PairingHeap, FibonacciHeap)
+ * - measureDijkstra():    average cycles per vertex plus a distance checksum,
+ *                         which must match across queues
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<cstdint>
+#include<cstdio>
+#include<limits>
+#include<utility>
+#include<vector>
+#include "../heap.hpp"
+#include "../indexed-min-heap.hpp"
+#include "bench-common.hpp"
+
+/**
+ * Directed graph in compressed sparse row form
+ */
+struct Graph {
+    std::vector<std::size_t> offsets;  // Edges of u are [offsets[u], offsets[u + 1])
+    std::vector<int> targets;
+    std::vector<std::uint32_t> weights;
+
+    int vertices() const { return static_cast<int>(offsets.size()) - 1; }
+};
+
+/**
+ * Build a graph from an edge generator called as edgesOf(u, emit)
+ */
+template<typename EdgesOf>
+Graph buildGraph(int vertices, EdgesOf edgesOf) {
+    Graph graph;
+    graph.offsets.push_back(0);
+    for (int u = 0; u < vertices; ++u) {
+        edgesOf(u, [&graph](int v, std::uint32_t weight) {
+            graph.targets.push_back(v);
+            graph.weights.push_back(weight);
+        });
+        graph.offsets.push_back(graph.targets.size());
+    }
+    return graph;
+}
+
+constexpr std::uint64_t unreached = std::numeric_limits<std::uint64_t>::max();
+
+inline std::uint64_t checksum(const std::vector<std::uint64_t>& distance) {
+    std::uint64_t sum = 0;
+    for (std::uint64_t d : distance) {
+        sum += d == unreached ? 0 : d;
+    }
+    return sum;
+}
+
+/**
+ * Dijkstra without decrease-key: every relaxation pushes a new
+ * (distance, vertex) entry and stale entries are skipped when popped
+ */
+template<typename Queue = Heap<std::pair<std::uint64_t, int>>>
+std::vector<std::uint64_t> dijkstraLazy(const Graph& graph, int source) {
+    std::vector<std::uint64_t> distance(graph.vertices(), unreached);
+    Queue queue(graph.vertices());
+    distance[source] = 0;
+    queue.push({0, source});
+    while (auto entry = queue.try_pop()) {
+        auto [dist, u] = *entry;
+        if (dist != distance[u]) {
+            continue;  // Stale entry: u was reached more cheaply already
+        }
+        for (std::size_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+            int v = graph.targets[e];
+            std::uint64_t candidate = dist + graph.weights[e];
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                queue.push({candidate, v});
+            }
+        }
+    }
+    return distance;
+}
+
+/**
+ * Dijkstra on an IndexedMinHeap: relaxations call change_priority
+ */
+template<std::size_t Arity = 2>
+std::vector<std::uint64_t> dijkstraIndexed(const Graph& graph, int source) {
+    std::vector<std::uint64_t> distance(graph.vertices(), unreached);
+    IndexedMinHeap<std::uint64_t, std::less<std::uint64_t>, Arity> queue(graph.vertices());
+    distance[source] = 0;
+    queue.push(source, 0);
+    while (!queue.empty()) {
+        int u = queue.pop();
+        std::uint64_t dist = distance[u];
+        for (std::size_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+            int v = graph.targets[e];
+            std::uint64_t candidate = dist + graph.weights[e];
+            if (candidate < distance[v]) {
+                if (distance[v] == unreached) {
+                    queue.push(v, candidate);
+                } else {
+                    queue.change_priority(v, candidate);
+                }
+                distance[v] = candidate;
+            }
+        }
+    }
+    return distance;
+}
+
+/**
+ * Dijkstra on a heap of (distance, vertex) with handles: relaxations call
+ * decrease_key through the handle stored per vertex
+ */
+template<typename Queue>
+std::vector<std::uint64_t> dijkstraHandles(const Graph& graph, int source) {
+    std::vector<std::uint64_t> distance(graph.vertices(), unreached);
+    std::vector<typename Queue::Handle> handle(graph.vertices(), nullptr);
+    Queue queue;
+    distance[source] = 0;
+    handle[source] = queue.push({0, source});
+    while (auto entry = queue.try_pop()) {
+        auto [dist, u] = *entry;
+        handle[u] = nullptr;  // Settled
+        for (std::size_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+            int v = graph.targets[e];
+            std::uint64_t candidate = dist + graph.weights[e];
+            if (candidate < distance[v]) {
+                if (distance[v] == unreached) {
+                    handle[v] = queue.push({candidate, v});
+                } else {
+                    queue.decrease_key(handle[v], {candidate, v});
+                }
+                distance[v] = candidate;
+            }
+        }
+    }
+    return distance;
+}
+
+/**
+ * Print one table row: average cycles per vertex of run(graph, 0) and the
+ * checksum of the distances it produced
+ */
+template<typename Run>
+void measureDijkstra(const char* name, const Graph& graph, Run run) {
+    const std::size_t rounds = benchRounds(graph.targets.size(), 20000000);
+    std::uint64_t cycles = 0;
+    std::uint64_t sum = 0;
+    for (std::size_t r = 0; r < rounds; ++r) {
+        std::uint64_t start = readCycles();
+        std::vector<std::uint64_t> distance = run(graph, 0);
+        cycles += readCycles() - start;
+        sum = checksum(distance);
+    }
+    std::printf("%12d  %-11s  %-17s  %12.1f  %20llu\n", graph.vertices(), "", name,
+                static_cast<double>(cycles) / rounds / graph.vertices(),
+                static_cast<unsigned long long>(sum));
+}
@@ -0,0 +1,134 @@
+/**
+ * Double-Ended Queue Benchmark: interval heap vs min-max heap vs two heaps
+ *
+ * Serving both the minimum and the maximum of one multiset:
+ * - two heaps:  the status quo; every element goes into a MinHeap-style and a
+ *               MaxHeap-style Heap with a unique id, and an element popped
+ *               from one side is marked dead and skipped when it surfaces on
+ *               the other (lazy deletion)
+ * - min-max:    MinMaxHeap, one array with alternating min and max levels
+ * - interval:   IntervalHeap, one array of [lo, hi] pairs
+ *
+ * Workloads on random ints:
+ * - window: sliding top-K; add every element of a stream and pop_min once
+ *           the queue holds more than n (the K in top-K)
+ * - mixed:  steady size n; 50% add, 25% pop_min, 25% pop_max
+ *
+ * Usage: double-ended-bench [sizes...]   (default: 1000 100000 1000000)
+ * Build: g++ -std=c++17 -O3 -march=native double-ended-bench.cpp -o double-ended-bench
+ */
+
+#include<cstdint>
+#include<cstdio>
+#include<functional>
+#include<utility>
+#include<vector>
+#include "../heap.hpp"
+#include "../interval-heap.hpp"
+#include "../min-max-heap.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+/**
+ * A MinHeap and a MaxHeap holding the same elements, with lazy deletion
+ */
+class TwoHeaps {
+    private:
+        using Entry = pair<int, uint32_t>;  // (key, id)
+
+        Heap<Entry, less<Entry>> low;
+        Heap<Entry, greater<Entry>> high;
+        vector<bool> dead;                  // dead[id]: popped from the other side
+        size_t count = 0;
+
+        template<typename Side>
+        void skipDead(Side& side) {
+            while (!side.empty() && dead[side.top().second]) {
+                side.pop();
+            }
+        }
+
+    public:
+        explicit TwoHeaps(size_t capacity) : low(capacity), high(capacity) {}
+
+        void add(int key) {
+            uint32_t id = static_cast<uint32_t>(dead.size());
+            dead.push_back(false);
+            low.push({key, id});
+            high.push({key, id});
+            count++;
+        }
+
+        int pop_min() {
+            skipDead(low);
+            Entry entry = low.pop();
+            dead[entry.second] = true;
+            count--;
+            return entry.first;
+        }
+
+        int pop_max() {
+            skipDead(high);
+            Entry entry = high.pop();
+            dead[entry.second] = true;
+            count--;
+            return entry.first;
+        }
+
+        size_t size() const {
+            return count;
+        }
+};
+
+template<typename Queue>
+double windowCycles(size_t n) {
+    const size_t stream = n * 8 > 4000000 ? n * 8 : 4000000;
+    BenchRandom rng(21);
+    Queue queue(n + 1);
+
+    uint64_t start = readCycles();
+    for (size_t i = 0; i < stream; ++i) {
+        queue.add(static_cast<int>(rng.next() >> 33));
+        if (queue.size() > n) {
+            doNotOptimize(queue.pop_min());
+        }
+    }
+    return static_cast<double>(readCycles() - start) / stream;
+}
+
+template<typename Queue>
+double mixedCycles(size_t n) {
+    const size_t ops = 4000000;
+    BenchRandom rng(23);
+    Queue queue(n);
+    for (size_t i = 0; i < n; ++i) {
+        queue.add(static_cast<int>(rng.next() >> 33));
+    }
+
+    uint64_t start = readCycles();
+    for (size_t i = 0; i < ops; ++i) {
+        uint64_t r = rng.next();
+        if ((r & 1) == 0 || queue.size() == 0) {
+            queue.add(static_cast<int>(r >> 33));
+        } else if ((r & 2) == 0) {
+            doNotOptimize(queue.pop_min());
+        } else {
+            doNotOptimize(queue.pop_max());
+        }
+    }
+    return static_cast<double>(readCycles() - start) / ops;
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {1000, 100000, 1000000});
+
+    printf("%12s  %-8s  %12s  %12s  %12s\n", "n", "workload", "two heaps", "min-max", "interval");
+    printf("(%s per operation)\n", cycleUnit());
+    for (size_t n : sizes) {
+        printf("%12zu  %-8s  %12.1f  %12.1f  %12.1f\n", n, "window", windowCycles<TwoHeaps>(n),
+               windowCycles<MinMaxHeap<int>>(n), windowCycles<IntervalHeap<int>>(n));
+        printf("%12zu  %-8s  %12.1f  %12.1f  %12.1f\n", n, "mixed", mixedCycles<TwoHeaps>(n),
+               mixedCycles<MinMaxHeap<int>>(n), mixedCycles<IntervalHeap<int>>(n));
+    }
+    return 0;
+}
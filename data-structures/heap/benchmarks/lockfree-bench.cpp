@@ -0,0 +1,110 @@
+/**
+ * Lock-Free Queue Benchmark: skiplist vs locked array heaps
+ *
+ * Throughput of a shared priority queue under two operation mixes:
+ * - 50/50: half add, half pop (the queue size stays near its start)
+ * - 90/10: 90% add, 10% pop (the queue grows; adds dominate)
+ * Queues:
+ * - mutex:     MinHeap behind a single std::mutex
+ * - per-slot:  ConcurrentMinHeap (one lock per slot)
+ * - skiplist:  SkipListQueue<int> (lock-free, epoch-based reclamation)
+ * The queue starts with 100000 random ints; every thread then runs an equal
+ * share of 4M operations. Reported in million operations per second of
+ * wall-clock time.
+ *
+ * Usage: lockfree-bench [thread counts...]   (default: 1 4 16 64)
+ * Build: g++ -std=c++17 -O3 -march=native -pthread lockfree-bench.cpp -o lockfree-bench
+ */
+
+#include<atomic>
+#include<chrono>
+#include<cstdint>
+#include<cstdio>
+#include<mutex>
+#include<optional>
+#include<thread>
+#include<vector>
+#include "../concurrent-heap.hpp"
+#include "../heap.hpp"
+#include "../skiplist-queue.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+/**
+ * MinHeap with every operation under one mutex
+ */
+class LockedMinHeap {
+    private:
+        MinHeap heap;
+        mutex lock;
+
+    public:
+        bool add(int value) {
+            lock_guard<mutex> guard(lock);
+            return heap.add(value);
+        }
+
+        optional<int> try_pop() {
+            lock_guard<mutex> guard(lock);
+            return heap.try_pop();
+        }
+};
+
+/**
+ * Million operations per second with the given number of threads, adding
+ * with probability addPercent / 100
+ */
+template<typename Queue>
+double throughput(size_t threads, unsigned addPercent) {
+    const size_t prefill = 100000;
+    const size_t ops = 4000000;
+
+    Queue queue;
+    BenchRandom fill(47);
+    for (size_t i = 0; i < prefill; ++i) {
+        queue.add(static_cast<int>(fill.next() >> 33));
+    }
+
+    atomic<bool> go{false};
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&queue, &go, t, threads, ops, addPercent]() {
+            BenchRandom rng(3000 + t);
+            while (!go.load(memory_order_acquire)) {
+                this_thread::yield();
+            }
+            for (size_t i = t; i < ops; i += threads) {
+                uint64_t r = rng.next();
+                if (r % 100 < addPercent) {
+                    queue.add(static_cast<int>(r >> 33));
+                } else {
+                    doNotOptimize(queue.try_pop());
+                }
+            }
+        });
+    }
+
+    auto start = chrono::steady_clock::now();
+    go.store(true, memory_order_release);
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return ops / elapsed.count() / 1e6;
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> threadCounts = benchSizes(argc, argv, {1, 4, 16, 64});
+
+    printf("%8s  %-6s  %10s  %10s  %10s\n", "threads", "mix", "mutex", "per-slot", "skiplist");
+    printf("(million operations per second; %u hardware threads)\n", thread::hardware_concurrency());
+    for (size_t threads : threadCounts) {
+        for (unsigned addPercent : {50u, 90u}) {
+            printf("%8zu  %2u/%-3u  %10.2f  %10.2f  %10.2f\n", threads, addPercent, 100 - addPercent,
+                   throughput<LockedMinHeap>(threads, addPercent),
+                   throughput<ConcurrentMinHeap>(threads, addPercent),
+                   throughput<SkipListQueue<int>>(threads, addPercent));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * Meld Benchmark: merging two priority queues
+ *
+ * Merges a shard of k random ints into a queue of n, the way work queues
+ * are rebalanced between workers:
+ * - pop/add loop:  drain the shard into the MinHeap one element at a time
+ * - Heap::meld:    append the smaller array and re-heapify its ancestors
+ * - LeftistHeap:   merge the two right spines, O(log n)
+ * - PairingHeap:   link the two roots, O(1) (plus adopting the node pool)
+ * Only the merge is timed; building the two queues is not.
+ *
+ * Usage: meld-bench [sizes...]   (default: 10000 1000000; shards of n/16 and n)
+ * Build: g++ -std=c++17 -O3 -march=native meld-bench.cpp -o meld-bench
+ */
+
+#include<cstdio>
+#include<vector>
+#include "../heap.hpp"
+#include "../leftist-heap.hpp"
+#include "../pairing-heap.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+vector<int> randomInts(size_t count, uint64_t seed) {
+    BenchRandom rng(seed);
+    vector<int> values(count);
+    for (int& value : values) {
+        value = static_cast<int>(rng.next() >> 33);
+    }
+    return values;
+}
+
+/**
+ * Average cycles to merge a queue built from shard into one built from base
+ * Meld is called as meld(queue, shardQueue)
+ */
+template<typename Queue, typename Meld>
+double meldCycles(const vector<int>& base, const vector<int>& shard, Meld meld) {
+    const size_t rounds = benchRounds(base.size() + shard.size(), 2000000);
+    uint64_t cycles = 0;
+    for (size_t r = 0; r < rounds; ++r) {
+        Queue queue(base.size() + shard.size());
+        Queue other(shard.size());
+        for (int value : base) {
+            queue.add(value);
+        }
+        for (int value : shard) {
+            other.add(value);
+        }
+
+        uint64_t start = readCycles();
+        meld(queue, other);
+        cycles += readCycles() - start;
+        doNotOptimize(queue.peek());
+    }
+    return static_cast<double>(cycles) / rounds;
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {10000, 1000000});
+
+    printf("%12s  %12s  %14s  %14s  %14s  %14s\n", "n", "shard", "pop/add loop", "Heap::meld",
+           "leftist", "pairing");
+    printf("(%s per merge)\n", cycleUnit());
+    for (size_t n : sizes) {
+        for (size_t k : {n / 16, n}) {
+            vector<int> base = randomInts(n, 3);
+            vector<int> shard = randomInts(k, 5);
+
+            double loop = meldCycles<MinHeap>(base, shard, [](MinHeap& queue, MinHeap& other) {
+                while (auto value = other.try_pop()) {
+                    queue.add(*value);
+                }
+            });
+            double array = meldCycles<MinHeap>(base, shard, [](MinHeap& queue, MinHeap& other) {
+                queue.meld(other);
+            });
+            double leftist = meldCycles<LeftistHeap<int>>(base, shard,
+                [](LeftistHeap<int>& queue, LeftistHeap<int>& other) { queue.meld(other); });
+            double pairing = meldCycles<PairingHeap<int>>(base, shard,
+                [](PairingHeap<int>& queue, PairingHeap<int>& other) { queue.meld(other); });
+
+            printf("%12zu  %12zu  %14.0f  %14.0f  %14.0f  %14.0f\n", n, k, loop, array, leftist, pairing);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * Move Semantics Benchmark: copying vs moving ~200-byte jobs through a heap
+ *
+ * Pushes n jobs and pops them all again, counting copy and move constructions
+ * and assignments of the payload:
+ * - add(job):              copies the job into the heap
+ * - push(std::move(job)):  moves it in
+ * - emplace(args...):      constructs it in place
+ * pop() always moves the top out. MoveOnlyJob holds a std::unique_ptr, so
+ * any accidental copy would fail to compile; its row proves the path is
+ * copy-free, and the counters show the same for the copyable job.
+ *
+ * Usage: move-bench [sizes...]   (default: 1000 1000000)
+ * Build: g++ -std=c++17 -O3 -march=native move-bench.cpp -o move-bench
+ */
+
+#include<cstdio>
+#include<cstring>
+#include<memory>
+#include<string>
+#include<vector>
+#include "../heap.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+/**
+ * Copyable job that counts how it is copied and moved
+ */
+struct CountedJob {
+    static inline size_t copies = 0;
+    static inline size_t moves = 0;
+
+    uint64_t priority = 0;
+    string owner;                 // Long enough to live on the heap
+    unsigned char context[152] = {};
+
+    CountedJob() = default;
+    CountedJob(uint64_t p, const string& o) : priority(p), owner(o) {}
+    CountedJob(const CountedJob& other) { *this = other; }
+    CountedJob(CountedJob&& other) noexcept { *this = std::move(other); }
+    CountedJob& operator=(const CountedJob& other) {
+        priority = other.priority;
+        owner = other.owner;
+        memcpy(context, other.context, sizeof(context));
+        ++copies;
+        return *this;
+    }
+    CountedJob& operator=(CountedJob&& other) noexcept {
+        priority = other.priority;
+        owner = std::move(other.owner);
+        memcpy(context, other.context, sizeof(context));
+        ++moves;
+        return *this;
+    }
+
+    bool operator<(const CountedJob& other) const { return priority < other.priority; }
+};
+
+/**
+ * Job that cannot be copied at all
+ */
+struct MoveOnlyJob {
+    uint64_t priority = 0;
+    unique_ptr<string> owner;
+    unsigned char context[176] = {};
+
+    MoveOnlyJob() = default;
+    MoveOnlyJob(uint64_t p, const string& o) : priority(p), owner(make_unique<string>(o)) {}
+    MoveOnlyJob(MoveOnlyJob&&) noexcept = default;
+    MoveOnlyJob& operator=(MoveOnlyJob&&) noexcept = default;
+
+    bool operator<(const MoveOnlyJob& other) const { return priority < other.priority; }
+};
+
+enum class Insert { Copy, Move, Emplace };
+
+template<typename Job>
+void run(const char* name, Insert mode, size_t n) {
+    const string owner = "batch-scheduler/worker-pool-17";
+    BenchRandom rng(5);
+    Heap<Job> heap(n);
+    CountedJob::copies = 0;
+    CountedJob::moves = 0;
+
+    uint64_t start = readCycles();
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t priority = rng.next();
+        if constexpr (is_copy_constructible_v<Job>) {
+            if (mode == Insert::Copy) {
+                Job job(priority, owner);
+                heap.add(job);
+                continue;
+            }
+        }
+        if (mode == Insert::Move) {
+            Job job(priority, owner);
+            heap.push(std::move(job));
+        } else {
+            heap.emplace(priority, owner);
+        }
+    }
+    while (!heap.empty()) {
+        Job job = heap.pop();
+        doNotOptimize(job.priority);
+    }
+    uint64_t cycles = readCycles() - start;
+
+    if constexpr (is_same_v<Job, CountedJob>) {
+        printf("%12zu  %-22s  %10.1f  %8.2f  %8.2f\n", n, name, static_cast<double>(cycles) / n,
+               static_cast<double>(CountedJob::copies) / n, static_cast<double>(CountedJob::moves) / n);
+    } else {
+        printf("%12zu  %-22s  %10.1f  %8s  %8s\n", n, name, static_cast<double>(cycles) / n, "0 (n/a)", "-");
+    }
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {1000, 1000000});
+
+    printf("%12s  %-22s  %10s  %8s  %8s\n", "jobs", "insert", "cyc/job", "copies", "moves");
+    printf("(%s per push+pop pair; copies and moves per job)\n", cycleUnit());
+    for (size_t n : sizes) {
+        run<CountedJob>("add (copy)", Insert::Copy, n);
+        run<CountedJob>("push (move)", Insert::Move, n);
+        run<CountedJob>("emplace", Insert::Emplace, n);
+        run<MoveOnlyJob>("move-only emplace", Insert::Emplace, n);
+        run<MoveOnlyJob>("move-only push (move)", Insert::Move, n);
+    }
+    return 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * MultiQueue Benchmark: throughput and rank error vs c
+ *
+ * A shared queue starts with 100000 random keys; every thread then runs an
+ * equal share of the operations, half add and half pop, chosen at random.
+ * Queues: MinHeap behind one std::mutex (strict order) and MultiQueue with
+ * c = 1, 2, 4, 8 lanes per thread.
+ * - Mops/s:     million operations per second of wall-clock time (4M operations)
+ * - rank error: for every pop, the number of smaller keys present at that
+ *               moment (0 for a strict queue). Measured on a separate run of
+ *               1M operations: every add is stamped before the call and every
+ *               pop after it, and the log is replayed in stamp order against
+ *               a Fenwick tree of the keys present. With more threads than
+ *               cores, a thread preempted between a pop and its stamp leaves
+ *               the key "present" for a whole time slice, which inflates
+ *               the measured error; compare c at thread counts <= cores.
+ *
+ * Usage: multiqueue-bench [thread counts...]   (default: 1 4 16 64)
+ * Build: g++ -std=c++17 -O3 -march=native -pthread multiqueue-bench.cpp -o multiqueue-bench
+ */
+
+#include<algorithm>
+#include<atomic>
+#include<chrono>
+#include<cstdint>
+#include<cstdio>
+#include<memory>
+#include<mutex>
+#include<optional>
+#include<string>
+#include<thread>
+#include<vector>
+#include "../heap.hpp"
+#include "../multi-queue.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+const size_t prefill = 100000;
+
+/**
+ * Heap<uint64_t> with every operation under one mutex
+ */
+class LockedHeap {
+    private:
+        Heap<uint64_t> heap;
+        mutex lock;
+
+    public:
+        bool add(uint64_t value) {
+            lock_guard<mutex> guard(lock);
+            return heap.add(value);
+        }
+
+        optional<uint64_t> try_pop() {
+            lock_guard<mutex> guard(lock);
+            return heap.try_pop();
+        }
+};
+
+struct Event {
+    uint64_t stamp;
+    uint64_t key;
+    bool pop;
+};
+
+/**
+ * Unique key: random high bits, the operation's id in the low 24 bits
+ */
+uint64_t makeKey(uint64_t random, size_t id) {
+    return (random >> 40) << 24 | id;
+}
+
+/**
+ * Run ops operations from the given number of threads; with a log, record
+ * every add and successful pop
+ * @return: Elapsed wall-clock seconds
+ */
+template<typename Queue>
+double run(Queue& queue, size_t threads, size_t ops, vector<vector<Event>>* log) {
+    BenchRandom fill(43);
+    for (size_t id = 0; id < prefill; ++id) {
+        uint64_t key = makeKey(fill.next(), id);
+        queue.add(key);
+        if (log != nullptr) {
+            (*log)[0].push_back({0, key, false});
+        }
+    }
+
+    atomic<bool> go{false};
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&queue, &go, log, t, threads, ops]() {
+            BenchRandom rng(2000 + t);
+            vector<Event>* events = log != nullptr ? &(*log)[t] : nullptr;
+            while (!go.load(memory_order_acquire)) {
+                this_thread::yield();
+            }
+            for (size_t i = t; i < ops; i += threads) {
+                uint64_t r = rng.next();
+                if (r & 1) {
+                    uint64_t key = makeKey(r, prefill + i);
+                    uint64_t stamp = events != nullptr ? readCycles() : 0;
+                    queue.add(key);
+                    if (events != nullptr) {
+                        events->push_back({stamp, key, false});
+                    }
+                } else {
+                    optional<uint64_t> key = queue.try_pop();
+                    if (events != nullptr && key) {
+                        events->push_back({readCycles(), *key, true});
+                    }
+                    doNotOptimize(key);
+                }
+            }
+        });
+    }
+
+    auto start = chrono::steady_clock::now();
+    go.store(true, memory_order_release);
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/**
+ * Replay a log in stamp order
+ * @return: (mean, max) rank error over all pops
+ */
+pair<double, uint64_t> rankError(const vector<vector<Event>>& log) {
+    vector<Event> events;
+    for (const vector<Event>& thread : log) {
+        events.insert(events.end(), thread.begin(), thread.end());
+    }
+    stable_sort(events.begin(), events.end(),
+                [](const Event& a, const Event& b) { return a.stamp < b.stamp; });
+
+    vector<uint64_t> keys;
+    for (const Event& event : events) {
+        if (!event.pop) {
+            keys.push_back(event.key);
+        }
+    }
+    sort(keys.begin(), keys.end());
+
+    vector<int64_t> fenwick(keys.size() + 1, 0);  // Count of present keys, by rank
+    auto update = [&fenwick](size_t index, int64_t delta) {
+        for (++index; index < fenwick.size(); index += index & (0 - index)) {
+            fenwick[index] += delta;
+        }
+    };
+    auto smaller = [&fenwick](size_t index) {
+        int64_t count = 0;
+        for (; index > 0; index -= index & (0 - index)) {
+            count += fenwick[index];
+        }
+        return count;
+    };
+
+    uint64_t total = 0;
+    uint64_t worst = 0;
+    size_t pops = 0;
+    for (const Event& event : events) {
+        size_t index = lower_bound(keys.begin(), keys.end(), event.key) - keys.begin();
+        if (event.pop) {
+            uint64_t rank = static_cast<uint64_t>(smaller(index));
+            total += rank;
+            worst = rank > worst ? rank : worst;
+            ++pops;
+            update(index, -1);
+        } else {
+            update(index, 1);
+        }
+    }
+    return {pops > 0 ? static_cast<double>(total) / pops : 0.0, worst};
+}
+
+template<typename Queue, typename Make>
+void report(size_t threads, const string& label, Make make) {
+    unique_ptr<Queue> queue = make();
+    double seconds = run(*queue, threads, 4000000, nullptr);
+
+    vector<vector<Event>> log(threads);
+    queue = make();
+    run(*queue, threads, 1000000, &log);
+    pair<double, uint64_t> error = rankError(log);
+
+    printf("%8zu  %-6s  %10.2f  %12.1f  %12llu\n", threads, label.c_str(), 4.0 / seconds,
+           error.first, static_cast<unsigned long long>(error.second));
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> threadCounts = benchSizes(argc, argv, {1, 4, 16, 64});
+
+    printf("%8s  %-6s  %10s  %12s  %12s\n", "threads", "queue", "Mops/s", "mean rank", "max rank");
+    printf("(%u hardware threads)\n", thread::hardware_concurrency());
+    for (size_t threads : threadCounts) {
+        report<LockedHeap>(threads, "mutex", []() { return make_unique<LockedHeap>(); });
+        for (size_t c : {1, 2, 4, 8}) {
+            report<MultiQueue<uint64_t>>(threads, "c=" + to_string(c), [threads, c]() {
+                return make_unique<MultiQueue<uint64_t>>(threads, c);
+            });
+        }
+    }
+    return 0;
+}
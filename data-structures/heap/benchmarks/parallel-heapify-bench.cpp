@@ -0,0 +1,94 @@
+/**
+ * Parallel Heapify Benchmark: heapifyParallel vs sequential Floyd build
+ *
+ * Builds a binary min-heap (the MinHeap layout) over n random ints with
+ * heap_sift::heapify, then with heapifyParallel on pools of 1, 2, 4, ...
+ * threads up to the number of hardware threads. Every run starts from the
+ * same shuffled copy and its output is checked with std::is_heap. Prints
+ * the best of 3 runs in wall-clock milliseconds, cycles per element, and
+ * the speedup over the sequential build: the speedup curve.
+ *
+ * Memory bandwidth caps the curve long before the core count does: the
+ * build touches every element only a few times.
+ *
+ * Usage: parallel-heapify-bench [sizes...]   (default: 1000000 50000000)
+ * Build: g++ -std=c++17 -O3 -march=native -pthread parallel-heapify-bench.cpp -o parallel-heapify-bench
+ */
+
+#include<algorithm>
+#include<chrono>
+#include<cstdio>
+#include<functional>
+#include<thread>
+#include<vector>
+#include "../heap-sift.hpp"
+#include "../thread-pool.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+struct BuildTime {
+    double milliseconds;
+    double cyclesPerElement;
+};
+
+/**
+ * Best of 3 builds of base with build(data, size)
+ */
+template<typename Build>
+BuildTime measure(const vector<int>& base, Build build) {
+    vector<int> work;
+    BuildTime best{0, 0};
+    for (int run = 0; run < 3; ++run) {
+        work = base;
+        auto start = chrono::steady_clock::now();
+        uint64_t cycles = readCycles();
+        build(work.data(), work.size());
+        cycles = readCycles() - cycles;
+        chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+        if (!is_heap(work.begin(), work.end(), greater<int>())) {
+            printf("invalid heap!\n");
+        }
+        if (run == 0 || elapsed.count() < best.milliseconds) {
+            best = {elapsed.count(), static_cast<double>(cycles) / base.size()};
+        }
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {1000000, 50000000});
+
+    size_t hardware = thread::hardware_concurrency();
+    vector<size_t> threadCounts;
+    for (size_t threads = 1; threads < hardware; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(hardware > 0 ? hardware : 1);
+
+    printf("%12s  %10s  %10s  %10s  %8s\n", "elements", "threads", "ms", cycleUnit(), "speedup");
+    printf("(%s per element; %zu hardware threads)\n", cycleUnit(), hardware);
+    for (size_t n : sizes) {
+        BenchRandom rng(29);
+        vector<int> base(n);
+        for (int& value : base) {
+            value = static_cast<int>(rng.next() >> 33);
+        }
+
+        less<int> comp;
+        BuildTime sequential = measure(base, [&comp](int* data, size_t size) {
+            heap_sift::heapify<2>(data, size, comp);
+        });
+        printf("%12zu  %10s  %10.1f  %10.2f  %8.2f\n", n, "heapify", sequential.milliseconds,
+               sequential.cyclesPerElement, 1.0);
+
+        for (size_t threads : threadCounts) {
+            ThreadPool pool(threads);
+            BuildTime parallel = measure(base, [&comp, &pool](int* data, size_t size) {
+                heap_sift::heapifyParallel<2>(data, size, comp, pool);
+            });
+            printf("%12zu  %10zu  %10.1f  %10.2f  %8.2f\n", n, threads, parallel.milliseconds,
+                   parallel.cyclesPerElement, sequential.milliseconds / parallel.milliseconds);
+        }
+    }
+    return 0;
+}
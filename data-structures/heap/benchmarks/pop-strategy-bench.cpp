@@ -0,0 +1,121 @@
+/**
+ * Pop Strategy Benchmark: top-down vs bottom-up (Floyd/Wegener) deletion
+ *
+ * For each size and key type, fills a heap and drains it with pop, reporting:
+ * - comparisons per pop (counted through a wrapping comparator)
+ * - cycles per pop (measured with the plain comparator)
+ *
+ * Key types:
+ * - int:    comparisons are nearly free, so the saving is small
+ * - string: 24-character keys sharing a long prefix, so every comparison
+ *           scans most of the string and halving them matters
+ *
+ * Usage: pop-strategy-bench [sizes...]   (default: 1000 1000000)
+ * Build: g++ -std=c++17 -O3 -march=native pop-strategy-bench.cpp -o pop-strategy-bench
+ */
+
+#include<cstdio>
+#include<functional>
+#include<string>
+#include<vector>
+#include "../heap.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+/**
+ * Comparator that counts how often it is called
+ */
+template<typename T>
+struct CountingLess {
+    size_t* counter = nullptr;
+
+    bool operator()(const T& a, const T& b) const {
+        ++*counter;
+        return a < b;
+    }
+};
+
+template<typename T>
+vector<T> makeKeys(size_t n);
+
+template<>
+vector<int> makeKeys<int>(size_t n) {
+    BenchRandom rng(7);
+    vector<int> keys(n);
+    for (int& key : keys) {
+        key = static_cast<int>(rng.next() >> 33);
+    }
+    return keys;
+}
+
+template<>
+vector<string> makeKeys<string>(size_t n) {
+    BenchRandom rng(7);
+    vector<string> keys(n);
+    char buffer[32];
+    for (string& key : keys) {
+        snprintf(buffer, sizeof(buffer), "tenant/queue/%010llu",
+                 static_cast<unsigned long long>(rng.next() % 10000000000ull));
+        key = buffer;
+    }
+    return keys;
+}
+
+/**
+ * Average comparisons per pop when draining a heap built from keys
+ */
+template<typename T, PopStrategy Strategy>
+double comparisonsPerPop(const vector<T>& keys) {
+    size_t counter = 0;
+    CountingLess<T> compare{&counter};
+    Heap<T, CountingLess<T>, vector<T>, Strategy> heap(keys.size(), HeapCapacity::Growable, compare);
+    heap.assign(keys.begin(), keys.end());
+
+    counter = 0;
+    while (!heap.empty()) {
+        heap.pop();
+    }
+    return static_cast<double>(counter) / keys.size();
+}
+
+/**
+ * Average cycles per pop when draining a heap built from keys
+ */
+template<typename T, PopStrategy Strategy>
+double cyclesPerPop(const vector<T>& keys) {
+    const size_t rounds = benchRounds(keys.size());
+    uint64_t cycles = 0;
+    for (size_t r = 0; r < rounds; ++r) {
+        Heap<T, less<T>, vector<T>, Strategy> heap(keys.begin(), keys.end());
+        uint64_t start = readCycles();
+        while (!heap.empty()) {
+            doNotOptimize(heap.pop());
+        }
+        cycles += readCycles() - start;
+    }
+    return static_cast<double>(cycles) / (static_cast<double>(keys.size()) * rounds);
+}
+
+template<typename T>
+void runRow(const char* typeName, size_t n) {
+    vector<T> keys = makeKeys<T>(n);
+    double topCompares = comparisonsPerPop<T, PopStrategy::TopDown>(keys);
+    double bottomCompares = comparisonsPerPop<T, PopStrategy::BottomUp>(keys);
+    double topCycles = cyclesPerPop<T, PopStrategy::TopDown>(keys);
+    double bottomCycles = cyclesPerPop<T, PopStrategy::BottomUp>(keys);
+    printf("%12zu  %-7s  %9.2f  %9.2f  %10.1f  %10.1f  %7.2fx\n", n, typeName,
+           topCompares, bottomCompares, topCycles, bottomCycles, topCycles / bottomCycles);
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {1000, 1000000});
+
+    printf("%12s  %-7s  %9s  %9s  %10s  %10s  %8s\n", "elements", "type",
+           "cmp/top", "cmp/bot", "top-down", "bottom-up", "speedup");
+    printf("(comparisons and %s per pop)\n", cycleUnit());
+    for (size_t n : sizes) {
+        runRow<int>("int", n);
+        runRow<string>("string", n);
+    }
+    return 0;
+}
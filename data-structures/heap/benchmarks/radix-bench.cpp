@@ -0,0 +1,63 @@
+/**
+ * Radix Heap Benchmark: monotone integer priorities
+ *
+ * Compares RadixHeap with the comparison-based array heaps on two
+ * workloads where every new key is at least the last key popped:
+ * - hold:       the classic event-simulation model; a queue of n pending
+ *               events, each step pops the earliest and schedules a new one
+ *               a random delay (1..65536) later
+ * - fill/drain: add n random keys, then pop them all (addPopCycles)
+ * Queues: Heap<uint64_t> (binary), DaryHeap<uint64_t, 4> and RadixHeap<uint64_t>.
+ *
+ * Usage: radix-bench [sizes...]   (default: 1000 100000 10000000)
+ * Build: g++ -std=c++17 -O3 -march=native radix-bench.cpp -o radix-bench
+ */
+
+#include<cstdint>
+#include<cstdio>
+#include<vector>
+#include "../heap.hpp"
+#include "../radix-heap.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+/**
+ * Average cycles per hold step (one pop plus one add) on a queue of n events
+ */
+template<typename Queue>
+double holdCycles(size_t n) {
+    BenchRandom rng(7);
+    Queue queue(n);
+    for (size_t i = 0; i < n; ++i) {
+        queue.add(rng.next() % 65536);
+    }
+
+    const size_t steps = n < 10000000 ? 10000000 : n;
+    uint64_t start = readCycles();
+    for (size_t i = 0; i < steps; ++i) {
+        uint64_t now = queue.pop();
+        queue.add(now + 1 + rng.next() % 65536);
+    }
+    uint64_t cycles = readCycles() - start;
+    doNotOptimize(queue.peek());
+    return static_cast<double>(cycles) / steps;
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {1000, 100000, 10000000});
+
+    printf("%12s  %-12s  %12s  %12s  %12s\n", "n", "workload", "binary", "4-ary", "radix");
+    printf("(%s per hold step, or per add + per pop)\n", cycleUnit());
+    for (size_t n : sizes) {
+        printf("%12zu  %-12s  %12.1f  %12.1f  %12.1f\n", n, "hold",
+               holdCycles<Heap<uint64_t>>(n), holdCycles<DaryHeap<uint64_t, 4>>(n),
+               holdCycles<RadixHeap<uint64_t>>(n));
+
+        auto binary = addPopCycles<Heap<uint64_t>, uint64_t>(n);
+        auto dary = addPopCycles<DaryHeap<uint64_t, 4>, uint64_t>(n);
+        auto radix = addPopCycles<RadixHeap<uint64_t>, uint64_t>(n);
+        printf("%12zu  %-12s  %12.1f  %12.1f  %12.1f\n", n, "fill: add", binary.first, dary.first, radix.first);
+        printf("%12zu  %-12s  %12.1f  %12.1f  %12.1f\n", n, "drain: pop", binary.second, dary.second, radix.second);
+    }
+    return 0;
+}
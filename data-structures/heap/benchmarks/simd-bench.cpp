@@ -0,0 +1,63 @@
+/**
+ * SIMD Child Selection Benchmark: scalar vs SSE4.1 vs AVX2 vs AVX-512
+ *
+ * Drains DaryHeaps of arity 4, 8 and 16 over every key type with kernels
+ * (int, unsigned, int64_t, uint64_t, float, double) with every SIMD level
+ * the CPU supports (via setSimdLevel) and prints cycles per pop. add never
+ * scans sibling groups, so only pop is reported. A level a key type has no
+ * kernel for (64-bit integers below AVX2) runs the scalar loop.
+ *
+ * Usage: simd-bench [sizes...]   (default: 1000 1000000 10000000)
+ * Build: g++ -std=c++17 -O3 simd-bench.cpp -o simd-bench
+ *        (no -march needed: kernels are selected at runtime)
+ */
+
+#include<cstdint>
+#include<cstdio>
+#include<vector>
+#include "../heap.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+template<typename Key, size_t D>
+void runArity(size_t n, const char* key, const vector<SimdLevel>& levels) {
+    printf("%12zu  %-8s  %5zu", n, key, D);
+    for (SimdLevel level : levels) {
+        setSimdLevel(level);
+        printf("  %9.1f", addPopCycles<DaryHeap<Key, D>, Key>(n).second);
+    }
+    printf("\n");
+}
+
+template<typename Key>
+void runKey(size_t n, const char* key, const vector<SimdLevel>& levels) {
+    runArity<Key, 4>(n, key, levels);
+    runArity<Key, 8>(n, key, levels);
+    runArity<Key, 16>(n, key, levels);
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {1000, 1000000, 10000000});
+
+    vector<SimdLevel> levels;
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level <= detectSimdLevel()) {
+            levels.push_back(level);
+        }
+    }
+
+    printf("%12s  %-8s  %5s", "elements", "key", "arity");
+    for (SimdLevel level : levels) {
+        printf("  %9s", simdLevelName(level));
+    }
+    printf("\n(%s per pop)\n", cycleUnit());
+    for (size_t n : sizes) {
+        runKey<int>(n, "int", levels);
+        runKey<unsigned>(n, "unsigned", levels);
+        runKey<int64_t>(n, "int64_t", levels);
+        runKey<uint64_t>(n, "uint64_t", levels);
+        runKey<float>(n, "float", levels);
+        runKey<double>(n, "double", levels);
+    }
+    return 0;
+}
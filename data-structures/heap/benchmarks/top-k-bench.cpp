@@ -0,0 +1,108 @@
+/**
+ * Top-K Benchmark: TopK vs add-then-pop on a MinHeap
+ *
+ * Keeps the K largest of a stream of n random ints:
+ * - push+pop:  the usual pattern on a MinHeap; add every element, pop once
+ *              the size exceeds K
+ * - TopK:      compare against the threshold first, replace_top on a win
+ * - parallel:  TopK split over the hardware threads (one TopK each, merged
+ *              at the end), wall-clock cycles per element
+ * Streams: random (wins get rarer as the stream goes on, ~K ln(n/K) in
+ * total) and ascending (every element wins: the worst case for TopK).
+ *
+ * Usage: top-k-bench [stream sizes...]   (default: 100000 10000000)
+ * Build: g++ -std=c++17 -O3 -march=native -pthread top-k-bench.cpp -o top-k-bench
+ */
+
+#include<cstdint>
+#include<cstdio>
+#include<thread>
+#include<vector>
+#include "../heap.hpp"
+#include "../top-k.hpp"
+#include "bench-common.hpp"
+using namespace std;
+
+vector<int> makeStream(size_t n, bool ascending) {
+    BenchRandom rng(31);
+    vector<int> stream(n);
+    for (size_t i = 0; i < n; ++i) {
+        stream[i] = ascending ? static_cast<int>(i) : static_cast<int>(rng.next() >> 33);
+    }
+    return stream;
+}
+
+template<size_t K>
+double pushPopCycles(const vector<int>& stream) {
+    MinHeap heap(K + 1);
+    uint64_t start = readCycles();
+    for (int value : stream) {
+        heap.add(value);
+        if (heap.size() > K) {
+            heap.pop();
+        }
+    }
+    uint64_t cycles = readCycles() - start;
+    doNotOptimize(heap.peek());
+    return static_cast<double>(cycles) / stream.size();
+}
+
+template<size_t K>
+double topKCycles(const vector<int>& stream) {
+    TopK<int, K> best;
+    uint64_t start = readCycles();
+    best.add(stream.begin(), stream.end());
+    uint64_t cycles = readCycles() - start;
+    doNotOptimize(best.peek());
+    return static_cast<double>(cycles) / stream.size();
+}
+
+template<size_t K>
+double parallelCycles(const vector<int>& stream) {
+    const size_t threads = thread::hardware_concurrency() > 0 ? thread::hardware_concurrency() : 1;
+    vector<TopK<int, K>> partial(threads);
+
+    uint64_t start = readCycles();
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&stream, &partial, t, threads]() {
+            size_t first = stream.size() * t / threads;
+            size_t last = stream.size() * (t + 1) / threads;
+            partial[t].add(stream.begin() + first, stream.begin() + last);
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    TopK<int, K> best;
+    for (TopK<int, K>& result : partial) {
+        best.merge(result);
+    }
+    uint64_t cycles = readCycles() - start;
+    doNotOptimize(best.peek());
+    return static_cast<double>(cycles) / stream.size();
+}
+
+template<size_t K>
+void report(size_t n, const char* label, const vector<int>& stream) {
+    printf("%12zu  %6zu  %-10s  %12.2f  %12.2f  %12.2f\n", n, K, label,
+           pushPopCycles<K>(stream), topKCycles<K>(stream), parallelCycles<K>(stream));
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = benchSizes(argc, argv, {100000, 10000000});
+
+    printf("%12s  %6s  %-10s  %12s  %12s  %12s\n", "n", "K", "stream", "push+pop", "TopK", "parallel");
+    printf("(%s per stream element; parallel on %u threads)\n", cycleUnit(),
+           thread::hardware_concurrency());
+    for (size_t n : sizes) {
+        for (bool ascending : {false, true}) {
+            vector<int> stream = makeStream(n, ascending);
+            const char* label = ascending ? "ascending" : "random";
+            report<10>(n, label, stream);
+            report<100>(n, label, stream);
+            report<10000>(n, label, stream);
+        }
+    }
+    return 0;
+}
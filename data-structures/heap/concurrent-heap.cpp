@@ -0,0 +1,74 @@
+/**
+ * ConcurrentHeap Demonstration in C++
+ *
+ * A few basic operations from one thread, then four producer threads
+ * filling one shared heap with job priorities and four consumer threads
+ * draining it, without any lock around the heap.
+ */
+
+#include<iostream>
+#include<thread>
+#include<vector>
+#include "concurrent-heap.hpp"
+using namespace std;
+
+int main() {
+    ConcurrentMinHeap heap;
+
+    for (int value : {42, 7, 19, 3, 25}) {
+        heap.add(value);
+    }
+    cout << "Heap: " << heap.toString() << endl;
+    cout << "Peek: " << heap.peek() << endl;
+    cout << "Pop: " << heap.pop() << ", then " << heap.pop() << endl;
+    cout << "Heap: " << heap.toString() << endl;
+    while (heap.try_pop()) {
+    }
+
+    const int threads = 4;
+    const int jobs = 10000;
+
+    // Producers: thread t adds the priorities congruent to t mod 4
+    vector<thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&heap, t]() {
+            for (int job = jobs - 1 - t; job >= 0; job -= threads) {
+                heap.add(job);
+            }
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    cout << "Added " << heap.size() << " jobs from " << threads << " threads, top " << heap.peek() << endl;
+
+    // Consumers: while only pops run, each thread sees its own pops in order
+    vector<int> popped(threads, 0);
+    vector<char> ordered(threads, 1);  // Not vector<bool>: threads write neighbouring flags
+    workers.clear();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&heap, &popped, &ordered, t]() {
+            int last = -1;
+            while (auto job = heap.try_pop()) {
+                ordered[t] = ordered[t] && *job > last;
+                last = *job;
+                popped[t]++;
+            }
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+
+    int total = 0;
+    bool inOrder = true;
+    for (int t = 0; t < threads; ++t) {
+        total += popped[t];
+        inOrder = inOrder && ordered[t];
+    }
+    cout << "Popped " << total << " jobs, each consumer in priority order: "
+         << (inOrder ? "yes" : "no") << endl;
+    cout << "Heap: " << heap.toString() << endl;
+
+    return 0;
+}
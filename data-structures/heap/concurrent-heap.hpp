@@ -0,0 +1,376 @@
+/**
+ * Concurrent Heap Implementation in C++
+ *
+ * A thread-safe binary heap with one lock per slot (Hunt, Michael,
+ * Parthasarathy and Scott, 1996), so that operations on different parts of
+ * the tree run in parallel instead of queueing on one mutex:
+ * - a short global lock guards only the element count; it hands out the
+ *   slot an operation starts from and is released straight away
+ * - add writes its element to the new last slot and bubbles it up,
+ *   holding at most a parent and a child lock at a time
+ * - pop takes the last element, swaps it into the root and sifts it down,
+ *   holding at most a node and its two children
+ * Locks are always taken top-down (parent before child), so operations
+ * cannot deadlock.
+ *
+ * Every slot carries a tag: Empty, Available, or the ticket of the add
+ * whose element is still bubbling up. An element in flight can be moved up
+ * by a concurrent pop; its add finds it again by following its ticket up
+ * the tree. Consecutive slots are handed out in bit-reversed order within
+ * a level, so consecutive adds bubble up through different subtrees.
+ *
+ * Storage is allocated level by level (level L holds 2^L slots) and never
+ * moves, so the heap grows without stopping concurrent operations. Slots
+ * hold their element in a std::optional, so T need not be
+ * default-constructible.
+ *
+ * API follows Heap: add/push/emplace, peek/try_peek, pop/try_pop, size,
+ * empty. There is no top(): a reference to the root would not survive a
+ * concurrent pop. size() and peek() are snapshots, and toString() must
+ * only be called while no other thread uses the heap.
+ *
+ * Time Complexities:
+ * - add / pop: O(log n), with O(1) time under the global lock
+ * - peek: O(1)
+ *
+ * Space Complexity: O(n)
+ */
+
+#pragma once
+
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<mutex>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<thread>
+#include<utility>
+#include "heap-sift.hpp"
+#include "spin-lock.hpp"
+
+template<typename T, typename Compare = std::less<T>>
+class ConcurrentHeap {
+    private:
+        static constexpr std::uint64_t Empty = 0;      // Slot holds no element
+        static constexpr std::uint64_t Available = 1;  // Slot holds a settled element
+        static constexpr unsigned maxLevels = 48;
+
+        struct Node {
+            SpinLock lock;
+            std::uint64_t tag = Empty;  // Empty, Available, or the ticket of an add in flight
+            std::optional<T> value;     // Engaged while tag != Empty
+        };
+
+        std::atomic<Node*> levels[maxLevels] = {};  // Level L: slots 2^L ... 2^(L+1)-1
+        SpinLock heapLock;                          // Guards count, nextTicket and allocation
+        std::atomic<std::size_t> count{0};
+        std::uint64_t nextTicket = 2;
+        Compare comp;
+
+        static unsigned levelOf(std::size_t slot) {
+            return 63 - static_cast<unsigned>(__builtin_clzll(slot));
+        }
+
+        /**
+         * Slot (1-based) of the n-th element: the first slot of its level
+         * plus its offset within the level with the bits reversed
+         */
+        static std::size_t slotOf(std::size_t n) {
+            const unsigned level = levelOf(n);
+            std::size_t offset = n - (std::size_t(1) << level);
+            std::size_t reversed = 0;
+            for (unsigned bit = 0; bit < level; ++bit) {
+                reversed = (reversed << 1) | ((offset >> bit) & 1);
+            }
+            return (std::size_t(1) << level) + reversed;
+        }
+
+        /**
+         * Node of slot, or nullptr if its level was never allocated
+         */
+        Node* find(std::size_t slot) const {
+            const unsigned level = levelOf(slot);
+            Node* base = levels[level].load(std::memory_order_acquire);
+            return base == nullptr ? nullptr : base + (slot - (std::size_t(1) << level));
+        }
+
+        /**
+         * Node of slot, allocating its level on first use
+         * Caller holds heapLock
+         */
+        Node& reach(std::size_t slot) {
+            const unsigned level = levelOf(slot);
+            if (levels[level].load(std::memory_order_relaxed) == nullptr) {
+                levels[level].store(new Node[std::size_t(1) << level], std::memory_order_release);
+            }
+            return *find(slot);
+        }
+
+        static void swapEntries(Node& a, Node& b) {
+            std::swap(a.value, b.value);
+            std::swap(a.tag, b.tag);
+        }
+
+        void insert(T value) {
+            heapLock.lock();
+            const std::size_t n = count.load(std::memory_order_relaxed) + 1;
+            count.store(n, std::memory_order_relaxed);
+            const std::uint64_t ticket = nextTicket++;
+            std::size_t slot = slotOf(n);
+            Node& last = reach(slot);
+            last.lock.lock();
+            heapLock.unlock();
+
+            last.value.emplace(std::move(value));
+            last.tag = ticket;
+            last.lock.unlock();
+
+            // Bubble up, following the element if a pop moved it
+            while (slot > 1) {
+                bool blocked = false;
+                {
+                    Node& parent = *find(slot / 2);
+                    Node& node = *find(slot);
+                    std::lock_guard<SpinLock> parentGuard(parent.lock);
+                    std::lock_guard<SpinLock> nodeGuard(node.lock);
+                    if (parent.tag == Available && node.tag == ticket) {
+                        if (comp(*node.value, *parent.value)) {
+                            swapEntries(node, parent);
+                            slot /= 2;
+                        } else {
+                            node.tag = Available;
+                            return;
+                        }
+                    } else if (parent.tag == Empty) {
+                        return;       // The element was taken by a pop
+                    } else if (node.tag != ticket) {
+                        slot /= 2;    // A pop moved the element up
+                    } else {
+                        blocked = true;  // The parent is another add's element in flight
+                    }
+                }
+                if (blocked) {
+                    std::this_thread::yield();  // Not while holding the locks the other add needs
+                }
+            }
+            Node& root = *find(1);
+            std::lock_guard<SpinLock> rootGuard(root.lock);
+            if (root.tag == ticket) {
+                root.tag = Available;
+            }
+        }
+
+        std::optional<T> remove() {
+            heapLock.lock();
+            const std::size_t n = count.load(std::memory_order_relaxed);
+            if (n == 0) {
+                heapLock.unlock();
+                return std::nullopt;
+            }
+            count.store(n - 1, std::memory_order_relaxed);
+            const std::size_t bottom = slotOf(n);
+            Node& last = *find(bottom);
+            last.lock.lock();
+            heapLock.unlock();
+
+            T result = std::move(*last.value);
+            last.value.reset();
+            last.tag = Empty;
+            last.lock.unlock();
+            if (bottom == 1) {
+                return result;
+            }
+
+            Node* node = find(1);
+            node->lock.lock();
+            if (node->tag == Empty || comp(result, *node->value)) {
+                // The root was emptied by another pop, or the last element
+                // (an add still in flight) beats it: it is the one to return
+                node->lock.unlock();
+                return result;
+            }
+            std::swap(result, *node->value);
+            node->tag = Available;
+
+            // Sift the old last element down from the root
+            for (std::size_t slot = 1;;) {
+                Node* left = find(2 * slot);
+                if (left == nullptr) {
+                    break;
+                }
+                Node* right = left + 1;  // Siblings share a level
+                left->lock.lock();
+                right->lock.lock();
+                Node* child;
+                if (left->tag == Empty) {
+                    right->lock.unlock();
+                    left->lock.unlock();
+                    break;
+                }
+                if (right->tag == Empty || comp(*left->value, *right->value)) {
+                    right->lock.unlock();
+                    child = left;
+                    slot = 2 * slot;
+                } else {
+                    left->lock.unlock();
+                    child = right;
+                    slot = 2 * slot + 1;
+                }
+                if (!comp(*child->value, *node->value)) {
+                    child->lock.unlock();
+                    break;
+                }
+                swapEntries(*child, *node);
+                node->lock.unlock();
+                node = child;
+            }
+            node->lock.unlock();
+            return result;
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty heap
+         * @param capacity: Number of elements to allocate slots for up front
+         * @param compare: Ordering used to arrange the elements
+         */
+        explicit ConcurrentHeap(std::size_t capacity = 0, const Compare& compare = Compare())
+            : comp(compare) {
+            for (std::size_t slot = 1; slot <= capacity; slot *= 2) {
+                reach(slot);
+            }
+        }
+
+        ConcurrentHeap(const ConcurrentHeap&) = delete;
+        ConcurrentHeap& operator=(const ConcurrentHeap&) = delete;
+
+        ~ConcurrentHeap() {
+            for (std::atomic<Node*>& level : levels) {
+                delete[] level.load(std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * Add an element to the heap; safe to call from any thread
+         * @param element: Value to be added
+         * @return: Always true; the heap grows on demand
+         */
+        bool add(const T& element) {
+            insert(element);
+            return true;
+        }
+
+        /**
+         * Add a copy of an element (same as add)
+         */
+        bool push(const T& element) {
+            return add(element);
+        }
+
+        /**
+         * Move an element into the heap
+         */
+        bool push(T&& element) {
+            insert(std::move(element));
+            return true;
+        }
+
+        /**
+         * Construct an element from args and insert it
+         * @param args: Constructor arguments for T
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args) {
+            insert(T(std::forward<Args>(args)...));
+            return true;
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The current top, or the empty sentinel if empty
+         */
+        T peek() const {
+            std::optional<T> top = try_peek();
+            return top ? std::move(*top) : heap_sift::emptyValue<T>(comp);
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The current top, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_peek() const {
+            Node* root = find(1);
+            if (root == nullptr) {
+                return std::nullopt;
+            }
+            std::lock_guard<SpinLock> rootGuard(root->lock);
+            if (root->tag == Empty) {
+                return std::nullopt;
+            }
+            return *root->value;
+        }
+
+        /**
+         * Remove and return the top element; safe to call from any thread
+         * @return: The element that was removed, or the empty sentinel if empty
+         */
+        T pop() {
+            std::optional<T> top = remove();
+            return top ? std::move(*top) : heap_sift::emptyValue<T>(comp);
+        }
+
+        /**
+         * Remove and return the top element; safe to call from any thread
+         * @return: The element that was removed, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_pop() {
+            return remove();
+        }
+
+        /**
+         * Get the number of elements (a snapshot while other threads run)
+         */
+        std::size_t size() const {
+            return count.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Check whether the heap holds no elements (a snapshot)
+         */
+        bool empty() const {
+            return size() == 0;
+        }
+
+        /**
+         * Convert heap to string representation for display: the occupied
+         * slots in level order (the last level fills in bit-reversed order)
+         * Not thread-safe: call only while no other thread uses the heap
+         * Requires T to support operator<<
+         */
+        std::string toString() const {
+            if (empty()) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            oss << '[';
+            std::size_t printed = 0;
+            for (std::size_t slot = 1; printed < size(); ++slot) {
+                const Node* node = find(slot);
+                if (node->tag != Empty) {
+                    oss << (printed++ == 0 ? "" : ",") << *node->value;
+                }
+            }
+            oss << ']';
+            return oss.str();
+        }
+};
+
+/**
+ * Thread-safe counterparts of MinHeap/MaxHeap
+ */
+using ConcurrentMinHeap = ConcurrentHeap<int, std::less<int>>;
+using ConcurrentMaxHeap = ConcurrentHeap<int, std::greater<int>>;
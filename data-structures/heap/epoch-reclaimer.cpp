@@ -0,0 +1,70 @@
+/**
+ * EpochReclaimer Demonstration in C++
+ *
+ * Replays the interleaving that decides whether epoch-based reclamation is
+ * safe: a node is retired by a thread whose own epoch trails the global
+ * one, while a reader pinned at the newer epoch still holds it. The node
+ * must survive until the reader leaves, however often the retiring thread
+ * re-enters in between.
+ */
+
+#include<atomic>
+#include<cstdint>
+#include<iostream>
+#include<thread>
+#include "epoch-reclaimer.hpp"
+using namespace std;
+
+struct Node {
+    atomic<bool> freed{false};
+};
+
+void markFreed(void* pointer) {
+    static_cast<Node*>(pointer)->freed.store(true);  // Kept alive to inspect it afterwards
+}
+
+int main() {
+    Node node;
+    atomic<int> step{0};
+
+    thread reader([&step]() {
+        while (step.load() != 1) {
+            this_thread::yield();
+        }
+        EpochReclaimer::enter();  // Pinned at the newer epoch, may read node
+        step.store(2);
+        while (step.load() != 3) {
+            this_thread::yield();
+        }
+        EpochReclaimer::leave();
+    });
+
+    EpochReclaimer::enter();                    // Writer pinned at epoch e
+    uint64_t start = EpochReclaimer::currentEpoch();
+    EpochReclaimer::tryAdvance();               // Global epoch e + 1
+    step.store(1);
+    while (step.load() != 2) {
+        this_thread::yield();
+    }
+    EpochReclaimer::retire(&node, markFreed);   // Unlinked while the writer still sits at e
+    EpochReclaimer::leave();
+
+    EpochReclaimer::tryAdvance();               // Global epoch e + 2; the reader is at e + 1
+    EpochReclaimer::enter();
+    EpochReclaimer::leave();
+    cout << "Epoch advanced by " << EpochReclaimer::currentEpoch() - start
+         << " while the reader was pinned" << endl;
+    cout << "Node freed under the reader: " << (node.freed.load() ? "yes (bug)" : "no") << endl;
+    bool safe = !node.freed.load();
+
+    step.store(3);
+    reader.join();
+    for (int i = 0; i < 3; ++i) {               // Nobody is pinned: advance and collect
+        EpochReclaimer::tryAdvance();
+        EpochReclaimer::enter();
+        EpochReclaimer::leave();
+    }
+    cout << "Node freed after the reader left: " << (node.freed.load() ? "yes" : "no") << endl;
+
+    return safe && node.freed.load() ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+/**
+ * Epoch-Based Memory Reclamation
+ *
+ * Lock-free structures unlink a node while other threads may still be
+ * reading it, so the node cannot be freed on the spot. With epochs:
+ * - every operation on the structure runs inside a Guard, which records
+ *   the global epoch the thread entered in
+ * - an unlinked node is retired: queued in the retiring thread's bucket,
+ *   tagged with the global epoch read at retire time, instead of being freed
+ * - the global epoch only advances once every thread inside a Guard has
+ *   entered in the current epoch; once it has reached tag + 2, no thread
+ *   can still hold a pointer to the node, and its bucket is freed the next
+ *   time its thread enters a Guard
+ *
+ * The tag must be the global epoch, not the retiring thread's own: that one
+ * can trail the global epoch by one, and a reader pinned at the newer epoch
+ * may still hold the node when the global epoch is only two past the older.
+ *
+ * One process-wide domain serves every structure. Each thread claims a
+ * record on first use and gives it back when it exits; a later thread
+ * reuses the record, together with whatever it still had to free.
+ * A thread stalled inside a Guard stops reclamation (not progress).
+ *
+ * Usage:
+ *   EpochReclaimer::Guard guard;           // Around every access
+ *   ... unlink node ...
+ *   EpochReclaimer::retire(node, destroy); // destroy(node) runs later
+ */
+
+#pragma once
+
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<vector>
+
+class EpochReclaimer {
+    private:
+        struct Retired {
+            void* pointer;
+            void (*destroy)(void*);
+        };
+
+        struct alignas(64) Record {
+            std::atomic<std::uint64_t> epoch{0};  // Epoch the owner entered in
+            std::atomic<bool> active{false};      // Owner is inside a Guard
+            std::atomic<bool> inUse{true};        // Claimed by a live thread
+            Record* next = nullptr;               // Records form a push-only list
+
+            // Owner only
+            std::uint64_t seen = 0;
+            unsigned nesting = 0;
+            unsigned retiredSinceAdvance = 0;
+            std::vector<Retired> garbage[3];      // Retired at global epoch e, at index e % 3
+            std::uint64_t garbageEpoch[3] = {};   // Tag of the nodes in each bucket
+        };
+
+        /**
+         * Thread-local owner of a record: hands it back when the thread exits
+         */
+        struct Owner {
+            Record* record = nullptr;
+
+            ~Owner() {
+                if (record != nullptr) {
+                    record->active.store(false);
+                    record->inUse.store(false, std::memory_order_release);
+                }
+            }
+        };
+
+        static constexpr unsigned advanceInterval = 64;  // Retires between attempts to advance
+
+        inline static std::atomic<std::uint64_t> globalEpoch{0};
+        inline static std::atomic<Record*> records{nullptr};
+
+        static Record* claimRecord() {
+            for (Record* record = records.load(std::memory_order_acquire); record != nullptr;
+                 record = record->next) {
+                bool expected = false;
+                if (!record->inUse.load(std::memory_order_relaxed) &&
+                    record->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                    return record;
+                }
+            }
+            Record* record = new Record;
+            Record* head = records.load(std::memory_order_relaxed);
+            do {
+                record->next = head;
+            } while (!records.compare_exchange_weak(head, record, std::memory_order_release,
+                                                    std::memory_order_relaxed));
+            return record;
+        }
+
+        static Record& local() {
+            thread_local Owner owner;
+            if (owner.record == nullptr) {
+                owner.record = claimRecord();
+            }
+            return *owner.record;
+        }
+
+        static void freeAll(std::vector<Retired>& bucket) {
+            for (const Retired& retired : bucket) {
+                retired.destroy(retired.pointer);
+            }
+            bucket.clear();
+        }
+
+    public:
+        /**
+         * Advance the global epoch if every active thread has entered in it
+         * retire calls this periodically; calling it directly is only
+         * needed to force progress (e.g. in a test)
+         */
+        static void tryAdvance() {
+            std::uint64_t epoch = globalEpoch.load();
+            for (Record* record = records.load(std::memory_order_acquire); record != nullptr;
+                 record = record->next) {
+                if (record->active.load() && record->epoch.load() != epoch) {
+                    return;
+                }
+            }
+            globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+        }
+
+        /**
+         * Current global epoch
+         */
+        static std::uint64_t currentEpoch() {
+            return globalEpoch.load();
+        }
+
+        /**
+         * Enter a critical section: pointers read from the structure stay
+         * valid until the matching leave. Calls may nest.
+         */
+        static void enter() {
+            Record& record = local();
+            if (record.nesting++ > 0) {
+                return;
+            }
+            record.active.store(true);
+            std::uint64_t epoch = globalEpoch.load();
+            while (true) {
+                record.epoch.store(epoch);
+                std::uint64_t again = globalEpoch.load();  // Recheck after announcing
+                if (again == epoch) {
+                    break;
+                }
+                epoch = again;
+            }
+            if (epoch != record.seen) {
+                record.seen = epoch;
+                for (int bucket = 0; bucket < 3; ++bucket) {
+                    if (record.garbageEpoch[bucket] + 2 <= epoch) {
+                        freeAll(record.garbage[bucket]);  // Retired two or more epochs ago
+                    }
+                }
+            }
+        }
+
+        /**
+         * Leave the critical section opened by the matching enter
+         */
+        static void leave() {
+            Record& record = local();
+            if (--record.nesting == 0) {
+                record.active.store(false, std::memory_order_release);
+            }
+        }
+
+        /**
+         * Free pointer with destroy once no thread can still be reading it
+         * Must be called inside a Guard, after pointer was unlinked
+         * @param pointer: Unlinked object
+         * @param destroy: Function that frees it
+         */
+        static void retire(void* pointer, void (*destroy)(void*)) {
+            Record& record = local();
+            std::uint64_t epoch = globalEpoch.load();
+            std::size_t bucket = epoch % 3;
+            if (record.garbageEpoch[bucket] != epoch) {
+                freeAll(record.garbage[bucket]);  // Tagged epoch - 3 or older: already safe
+                record.garbageEpoch[bucket] = epoch;
+            }
+            record.garbage[bucket].push_back({pointer, destroy});
+            if (++record.retiredSinceAdvance >= advanceInterval) {
+                record.retiredSinceAdvance = 0;
+                tryAdvance();
+            }
+        }
+
+        /**
+         * RAII critical section: enter on construction, leave on destruction
+         */
+        class Guard {
+            public:
+                Guard() {
+                    enter();
+                }
+
+                ~Guard() {
+                    leave();
+                }
+
+                Guard(const Guard&) = delete;
+                Guard& operator=(const Guard&) = delete;
+        };
+};
@@ -0,0 +1,58 @@
+/**
+ * FibonacciHeap Demonstration in C++
+ *
+ * Runs Prim's minimum spanning tree on a small dense graph given as an
+ * adjacency matrix, the textbook setting for a Fibonacci heap: every edge
+ * may lower a key, and decrease_key is O(1) amortized.
+ */
+
+#include<iostream>
+#include<vector>
+#include "fibonacci-heap.hpp"
+using namespace std;
+
+int main() {
+    // Symmetric weight matrix; 0 means no edge
+    vector<vector<int>> weight = {
+        {0, 2, 0, 6, 0},
+        {2, 0, 3, 8, 5},
+        {0, 3, 0, 0, 7},
+        {6, 8, 0, 0, 9},
+        {0, 5, 7, 9, 0}
+    };
+    const int vertices = static_cast<int>(weight.size());
+
+    // Keys are (edge weight, vertex); vertex 0 starts the tree
+    FibonacciHeap<pair<int, int>> queue;
+    vector<FibonacciHeap<pair<int, int>>::Handle> handle(vertices, nullptr);
+    vector<int> parent(vertices, -1);
+    vector<bool> inTree(vertices, false);
+    handle[0] = queue.push({0, 0});
+
+    int total = 0;
+    while (auto entry = queue.try_pop()) {
+        auto [w, u] = *entry;
+        handle[u] = nullptr;
+        inTree[u] = true;
+        total += w;
+        if (parent[u] != -1) {
+            cout << "Tree edge " << parent[u] << " - " << u << " (weight " << w << ")" << endl;
+        }
+
+        for (int v = 0; v < vertices; ++v) {
+            if (weight[u][v] == 0 || inTree[v]) {
+                continue;
+            }
+            if (handle[v] == nullptr) {
+                handle[v] = queue.push({weight[u][v], v});
+                parent[v] = u;
+            } else if (weight[u][v] < queue.value(handle[v]).first) {
+                queue.decrease_key(handle[v], {weight[u][v], v});
+                parent[v] = u;
+            }
+        }
+    }
+    cout << "Total weight of the spanning tree: " << total << endl;
+
+    return 0;
+}
@@ -0,0 +1,353 @@
+/**
+ * Heap Sift Kernels
+ *
+ * The sift loops shared by every array-backed heap in this directory (Heap,
+ * DaryHeap, AddressableHeap, ...). Each kernel works on a random-access
+ * iterator `data` pointing at the root and uses 0-based logical indices:
+ * - Children of node i: Arity*i + 1 ... Arity*i + Arity
+ * - Parent of node i: (i - 1) / Arity
+ *
+ * The kernels move a hole instead of swapping: the travelling element is held
+ * in a local, parents/children are shifted into the hole, and the element is
+ * written once at its final slot.
+ *
+ * Placed: callback invoked as placed(index) every time an element lands in
+ * slot index. Heaps that track element positions (handles, dense ids) update
+ * their position map there, inside the sift loops; NoPlacement compiles away.
+ *
+ * Arithmetic keys (32/64-bit integers, float, double) ordered by
+ * std::less/std::greater with 4, 8 or 16 children per node scan full sibling
+ * groups with a SIMD kernel (see simd-select.hpp). The kernel loads a whole
+ * sibling group from memory, so it is only used when `data` is a raw
+ * pointer; other iterators (deque, strided, proxy) take the scalar loop.
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<functional>
+#include<iterator>
+#include<limits>
+#include<type_traits>
+#include<utility>
+#include "simd-select.hpp"
+
+namespace heap_sift {
+
+    /**
+     * Placement callback for heaps that do not track positions
+     */
+    struct NoPlacement {
+        void operator()(std::size_t) const {}
+    };
+
+    /**
+     * Value returned by peek/pop on an empty heap: the value that loses
+     * every comparison (INT_MAX for a min-heap, INT_MIN for a max-heap).
+     * Types without numeric limits fall back to a default-constructed T.
+     */
+    template<typename T, typename Compare>
+    T emptyValue(const Compare& comp) {
+        if constexpr (std::numeric_limits<T>::is_specialized) {
+            const T low = std::numeric_limits<T>::lowest();
+            const T high = std::numeric_limits<T>::max();
+            return comp(low, high) ? high : low;
+        } else {
+            return T();
+        }
+    }
+
+    template<std::size_t Arity>
+    constexpr std::size_t parentOf(std::size_t index) {
+        return (index - 1) / Arity;
+    }
+
+    template<std::size_t Arity>
+    constexpr std::size_t firstChildOf(std::size_t index) {
+        return Arity * index + 1;
+    }
+
+    /**
+     * Move the element at index out into a value of the element type;
+     * deducing from data[index] would keep a proxy reference (vector<bool>)
+     * aliasing the very slot the sift overwrites first
+     */
+    template<typename RandomIt>
+    typename std::iterator_traits<RandomIt>::value_type takeAt(RandomIt data, std::size_t index) {
+        return std::move(data[index]);
+    }
+
+    /**
+     * Index of the winning child among the children in [child, end)
+     */
+    template<typename RandomIt, typename Compare>
+    std::size_t bestChild(RandomIt data, std::size_t child, std::size_t end, Compare& comp) {
+        std::size_t best = child;
+        for (++child; child < end; ++child) {
+            if (comp(data[child], data[best])) {
+                best = child;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Index of the winning child of a full sibling group starting at child
+     */
+    template<std::size_t Arity, typename RandomIt, typename Compare>
+    std::size_t bestChildGroup(RandomIt data, std::size_t child, Compare& comp) {
+        using T = typename std::iterator_traits<RandomIt>::value_type;
+        constexpr bool simdMin = simdSelectKey<T> && std::is_same_v<Compare, std::less<T>>;
+        constexpr bool simdMax = simdSelectKey<T> && std::is_same_v<Compare, std::greater<T>>;
+        constexpr bool simdArity = Arity == 4 || Arity == 8 || Arity == 16;
+        constexpr bool contiguous = std::is_pointer_v<RandomIt>;  // Siblings adjacent in memory
+
+        if constexpr ((simdMin || simdMax) && simdArity && contiguous) {
+            return child + childSelector<Arity, simdMax, T>()(&data[child]);
+        } else {
+            return bestChild(data, child, child + Arity, comp);
+        }
+    }
+
+    /**
+     * Bubble up: drop value into the hole at index and move the hole towards
+     * the root, shifting down every parent that loses against value
+     * @return: Final index of value
+     */
+    template<std::size_t Arity, typename RandomIt, typename T, typename Compare,
+             typename Placed = NoPlacement>
+    std::size_t siftUp(RandomIt data, std::size_t index, T value, Compare& comp,
+                       Placed placed = Placed()) {
+        while (index > 0) {
+            std::size_t parent = parentOf<Arity>(index);
+            if (!comp(value, data[parent])) {
+                break;  // Heap property satisfied
+            }
+            data[index] = std::move(data[parent]);
+            placed(index);
+            index = parent;
+        }
+        data[index] = std::move(value);
+        placed(index);
+        return index;
+    }
+
+    /**
+     * Bubble down: drop value into the hole at index and move the hole towards
+     * the leaves, shifting up the winning child while it beats value
+     * @param size: Number of elements in the heap
+     * @return: Final index of value
+     */
+    template<std::size_t Arity, typename RandomIt, typename T, typename Compare,
+             typename Placed = NoPlacement>
+    std::size_t siftDown(RandomIt data, std::size_t size, std::size_t index, T value,
+                         Compare& comp, Placed placed = Placed()) {
+        std::size_t child = firstChildOf<Arity>(index);
+        while (child < size) {  // While current node has at least one child
+            std::size_t best = child + Arity <= size ? bestChildGroup<Arity>(data, child, comp)
+                                                     : bestChild(data, child, size, comp);
+            if (!comp(data[best], value)) {
+                break;  // Heap property satisfied
+            }
+            data[index] = std::move(data[best]);
+            placed(index);
+            index = best;
+            child = firstChildOf<Arity>(index);
+        }
+        data[index] = std::move(value);
+        placed(index);
+        return index;
+    }
+
+    /**
+     * Bottom-up (Floyd/Wegener) bubble down: first move the hole at index all
+     * the way to a leaf, always following the winning child (one comparison
+     * per level), then bubble value up from that leaf, never above index
+     * @param size: Number of elements in the heap
+     * @return: Final index of value
+     */
+    template<std::size_t Arity, typename RandomIt, typename T, typename Compare,
+             typename Placed = NoPlacement>
+    std::size_t siftDownBottomUp(RandomIt data, std::size_t size, std::size_t index, T value,
+                                 Compare& comp, Placed placed = Placed()) {
+        const std::size_t start = index;
+        std::size_t child = firstChildOf<Arity>(index);
+
+        // Phase 1: walk the hole down to a leaf
+        while (child + Arity <= size) {  // All children exist
+            std::size_t best = bestChildGroup<Arity>(data, child, comp);
+            data[index] = std::move(data[best]);
+            placed(index);
+            index = best;
+            child = firstChildOf<Arity>(index);
+        }
+        if (child < size) {              // Only some children exist
+            std::size_t best = bestChild(data, child, size, comp);
+            data[index] = std::move(data[best]);
+            placed(index);
+            index = best;
+        }
+
+        // Phase 2: value usually belongs near the bottom, so this is short
+        while (index > start) {
+            std::size_t parent = parentOf<Arity>(index);
+            if (!comp(value, data[parent])) {
+                break;
+            }
+            data[index] = std::move(data[parent]);
+            placed(index);
+            index = parent;
+        }
+        data[index] = std::move(value);
+        placed(index);
+        return index;
+    }
+
+    /**
+     * Floyd's build-heap: sift down every internal node, from the last
+     * parent back to the root. Most nodes sit near the leaves and move
+     * only a level or two, so the whole pass is O(n) rather than the
+     * O(n log n) of n separate inserts.
+     */
+    template<std::size_t Arity, typename RandomIt, typename Compare,
+             typename Placed = NoPlacement>
+    void heapify(RandomIt data, std::size_t size, Compare& comp, Placed placed = Placed()) {
+        if (size < 2) {
+            if (size == 1) {
+                placed(0);
+            }
+            return;
+        }
+        if constexpr (!std::is_same_v<Placed, NoPlacement>) {
+            for (std::size_t index = parentOf<Arity>(size - 1) + 1; index < size; ++index) {
+                placed(index);  // Leaves never move; record where they are
+            }
+        }
+        for (std::size_t index = parentOf<Arity>(size - 1) + 1; index-- > 0;) {
+            siftDown<Arity>(data, size, index, takeAt(data, index), comp, placed);
+        }
+    }
+
+    /**
+     * Restore the heap after elements were appended at [first, size)
+     * Sifts down the parents of the new range, then their parents, and so
+     * on up to the root. Each level's range is contiguous and shrinks by a
+     * factor of Arity, so this costs O(k + log^2 n) instead of a full
+     * O(n) rebuild; nodes already fixed on a lower level are skipped.
+     */
+    template<std::size_t Arity, typename RandomIt, typename Compare,
+             typename Placed = NoPlacement>
+    void heapifyAppended(RandomIt data, std::size_t size, std::size_t first, Compare& comp,
+                         Placed placed = Placed()) {
+        if (first == 0 || first >= size) {
+            heapify<Arity>(data, size, comp, placed);
+            return;
+        }
+        if constexpr (!std::is_same_v<Placed, NoPlacement>) {
+            for (std::size_t index = first; index < size; ++index) {
+                placed(index);
+            }
+        }
+        std::size_t low = parentOf<Arity>(first);
+        std::size_t high = parentOf<Arity>(size - 1);
+        while (true) {
+            for (std::size_t index = high + 1; index-- > low;) {
+                siftDown<Arity>(data, size, index, takeAt(data, index), comp, placed);
+            }
+            if (low == 0) {
+                break;
+            }
+            std::size_t parentHigh = parentOf<Arity>(high);
+            high = parentHigh < low ? parentHigh : low - 1;
+            low = parentOf<Arity>(low);
+        }
+    }
+
+    /**
+     * Floyd's build-heap restricted to the subtree under root: the subtree
+     * is walked level by level, deepest internal level first. Subtrees with
+     * disjoint roots touch disjoint slots, so they can be built concurrently.
+     * @param size: Number of elements in the whole heap
+     */
+    template<std::size_t Arity, typename RandomIt, typename Compare>
+    void heapifySubtree(RandomIt data, std::size_t size, std::size_t root, Compare& comp) {
+        if (size < 2 || root > parentOf<Arity>(size - 1)) {
+            return;  // Leaf or outside the heap
+        }
+        const std::size_t lastParent = parentOf<Arity>(size - 1);
+        std::size_t first = root;
+        std::size_t width = 1;
+        while (firstChildOf<Arity>(first) <= lastParent) {  // Descend to the deepest internal level
+            first = firstChildOf<Arity>(first);
+            width *= Arity;
+        }
+        while (true) {
+            std::size_t end = first + width <= lastParent ? first + width : lastParent + 1;
+            for (std::size_t index = end; index-- > first;) {
+                siftDown<Arity>(data, size, index, takeAt(data, index), comp);
+            }
+            if (first == root) {
+                break;
+            }
+            first = parentOf<Arity>(first);
+            width /= Arity;
+        }
+    }
+
+    /**
+     * Floyd's build-heap on a thread pool, for arrays far larger than cache
+     * - Phase 1: pick the shallowest level whose subtrees hold at most
+     *   cutoff elements (and that has at least 4 subtrees per thread); every
+     *   subtree there is built sequentially by one task, so its sifts stay in
+     *   one thread's cache
+     * - Phase 2: the levels above are fixed from the bottom up; the nodes of
+     *   one level are independent, so each level is split into contiguous
+     *   blocks that run in parallel, with a barrier between levels
+     * Produces exactly the array heapify would. comp is called from several
+     * threads at once and must be safe for that.
+     * @param pool: Anything with size() (threads per loop) and
+     *              run(count, task(index)) (see thread-pool.hpp)
+     * @param cutoff: Largest subtree built by a single task
+     */
+    template<std::size_t Arity, typename RandomIt, typename Compare, typename Pool>
+    void heapifyParallel(RandomIt data, std::size_t size, Compare& comp, Pool& pool,
+                         std::size_t cutoff = std::size_t(1) << 16) {
+        const std::size_t threads = pool.size();
+        if (threads < 2 || size <= cutoff || size < 2) {
+            heapify<Arity>(data, size, comp);
+            return;
+        }
+        const std::size_t lastParent = parentOf<Arity>(size - 1);
+        const std::size_t minTasks = 4 * threads;  // Slack for uneven subtrees
+
+        std::size_t first = 0;
+        std::size_t width = 1;
+        while (firstChildOf<Arity>(first) <= lastParent && (width < minTasks || size / width > cutoff)) {
+            first = firstChildOf<Arity>(first);
+            width *= Arity;
+        }
+
+        // Phase 1: independent subtrees, one task each
+        std::size_t subtrees = first + width <= size ? width : size - first;
+        pool.run(subtrees, [&](std::size_t i) {
+            heapifySubtree<Arity>(data, size, first + i, comp);
+        });
+
+        // Phase 2: the levels above, one level at a time
+        while (first > 0) {
+            first = parentOf<Arity>(first);
+            width /= Arity;
+            std::size_t end = first + width <= lastParent ? first + width : lastParent + 1;
+            std::size_t nodes = end - first;
+            std::size_t blocks = nodes < minTasks ? nodes : minTasks;
+            pool.run(blocks, [&](std::size_t block) {
+                std::size_t low = first + nodes * block / blocks;
+                std::size_t high = first + nodes * (block + 1) / blocks;
+                for (std::size_t index = high; index-- > low;) {
+                    siftDown<Arity>(data, size, index, takeAt(data, index), comp);
+                }
+            });
+        }
+    }
+
+}  // namespace heap_sift
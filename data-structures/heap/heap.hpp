@@ -0,0 +1,603 @@
+/**
+ * Generic Heap Implementation in C++
+ *
+ * A complete d-ary heap data structure (binary by default) parameterised on:
+ * - T:         the element type (int, 64-bit keys, timestamps, small structs, ...)
+ * - Compare:   the ordering; comp(a, b) == true means a belongs above b
+ *              (std::less gives a min-heap, std::greater gives a max-heap)
+ * - Container: the backing contiguous storage (HeapStorage<T>: a vector
+ *              whose allocator is a template parameter, cache-line aligned
+ *              by default; use HugePageAllocator for multi-GB heaps)
+ * - Strategy:  how pop restores the heap (PopStrategy::TopDown by default)
+ * - Arity:     children per node (2 by default; DaryHeap<T, D> for 4, 8, ...)
+ *
+ * The comparator is a template argument, so every comparison in the sift
+ * routines is inlined at compile time and MinHeap/MaxHeap share one code path.
+ * The sift routines (heap-sift.hpp) move a hole instead of swapping: the
+ * travelling element is held in a local, parents/children are shifted into
+ * the hole, and the element is written once at its final slot (one write per
+ * level, not three).
+ *
+ * Layout: the root lives at index Arity-1 and the slots before it are unused
+ * (index 0 for a binary heap). The children of node i are the Arity slots
+ * starting at Arity*(i - Arity + 2), which is always a multiple of Arity, so
+ * with the default line-aligned storage every sibling group of
+ * Arity*sizeof(T) <= 64 bytes sits in a single cache line. Wider nodes make
+ * the tree shallower: pop touches fewer, denser levels at the cost of
+ * Arity-1 comparisons per level.
+ *
+ * Heaps of 32/64-bit integers, float or double ordered by std::less/std::greater
+ * with 4, 8 or 16 children per node pick the winning child of a full sibling
+ * group with a SIMD kernel (SSE4.1/AVX2/AVX-512, chosen at runtime; see
+ * simd-select.hpp).
+ *
+ * Pop strategies:
+ * - TopDown:  sift the last element down from the root, comparing it with the
+ *             winning child on every level (~2 log n comparisons)
+ * - BottomUp: Floyd/Wegener deletion; walk the hole to a leaf along the winning
+ *             children (one comparison per level), then sift the last element
+ *             up from there (log n + O(1) comparisons on average). Pays off
+ *             when comparisons are expensive (string keys, composite structs).
+ *
+ * Empty heaps: try_peek/try_pop return std::nullopt. peek/pop keep returning
+ * a sentinel (the value that loses every comparison), which cannot be told
+ * apart from a stored value of the same magnitude. The heap never performs
+ * I/O, so an empty check on a hot path costs no syscall or flush.
+ *
+ * Move-only and heavyweight elements: push(T&&) and emplace(args...) build
+ * the element directly in the backing store, the sift loops only move
+ * elements, and pop/try_pop move the top out, so no operation copies.
+ * Give T a noexcept move constructor so that growing the storage moves too.
+ * The unused slots before the root require T to be default-constructible.
+ *
+ * Capacity modes:
+ * - Growable (default): storage grows geometrically by a configurable growth
+ *   factor, so add never fails; reserve/shrink_to_fit manage the allocation
+ * - Bounded: at most `capacity` elements; add reports overflow by returning false
+ *
+ * Time Complexities:
+ * - Insert: O(log n)
+ * - Delete (pop): O(log n)
+ * - Replace top (replace_top): O(log n), one sift-down
+ * - Peek: O(1)
+ * - Build heap (range constructor / assign): O(n), O(n / p + log^2 n) span on p threads
+ * - Bulk insert of k elements (push_bulk): O(k + log^2 n)
+ * - Meld with a heap of k <= n elements: O(k + log^2 n)
+ * - Bulk pop of k elements (pop_n): O(k log n)
+ *
+ * Space Complexity: O(n)
+ */
+
+#pragma once
+
+#include<cmath>
+#include<cstddef>
+#include<functional>
+#include<iterator>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<type_traits>
+#include<utility>
+#include<vector>
+#include "aligned-allocator.hpp"
+#include "heap-sift.hpp"
+
+/**
+ * Capacity mode of a heap: grow on demand, or reject inserts once full
+ */
+enum class HeapCapacity { Growable, Bounded };
+
+/**
+ * Algorithm used by pop to refill the root: see the header comment
+ */
+enum class PopStrategy { TopDown, BottomUp };
+
+/**
+ * Backing storage of a heap: a vector with a pluggable allocator
+ */
+template<typename T, typename Allocator = CacheAlignedAllocator<T>>
+using HeapStorage = std::vector<T, Allocator>;
+
+template<typename T, typename Compare = std::less<T>, typename Container = HeapStorage<T>,
+         PopStrategy Strategy = PopStrategy::TopDown, std::size_t Arity = 2>
+class Heap {
+    static_assert(Arity >= 2, "A heap node needs at least two children");
+
+    private:
+        static constexpr std::size_t root = Arity - 1;  // Index of the root element
+
+        Container heap;                   // Heap elements, starting at index root
+        std::size_t heapSize = 0;         // Maximum number of elements in Bounded mode
+        HeapCapacity mode = HeapCapacity::Growable;
+        double growth = 2.0;              // Capacity multiplier used in Growable mode
+        Compare comp;                     // comp(a, b) is true when a must sit above b
+
+        /**
+         * Make room for one more element, growing the storage by the growth
+         * factor (and by at least one slot) when it is full
+         */
+        void grow() {
+            if (heap.size() < heap.capacity()) {
+                return;
+            }
+            std::size_t target = grownCapacity();
+            heap.reserve(target > heap.capacity() ? target : heap.capacity() + 1);
+        }
+
+        /**
+         * Capacity times the growth factor, capped at max_size() before the
+         * conversion (a double beyond the range of size_t has no defined cast)
+         */
+        std::size_t grownCapacity() const {
+            const double limit = static_cast<double>(heap.max_size());
+            const double target = static_cast<double>(heap.capacity()) * growth;
+            return target < limit ? static_cast<std::size_t>(target) : heap.max_size();
+        }
+
+        /**
+         * Pointer to the root: the sift kernels use 0-based logical indices,
+         * and only take their SIMD path on raw pointers
+         */
+        T* data() {
+            return heap.data() + root;
+        }
+
+        /**
+         * Check whether element lives inside the heap's own storage, in which
+         * case growing the storage would leave the reference dangling
+         */
+        bool inStorage(const T& element) const {
+            std::less<const T*> before;
+            return !before(&element, heap.data()) && before(&element, heap.data() + heap.size());
+        }
+
+        /**
+         * Append a range to the end of the storage without restoring order
+         * A Bounded heap takes only as many elements as its limit allows
+         * @return: false if part of the range was dropped, true otherwise
+         */
+        template<typename InputIt>
+        bool append(InputIt first, InputIt last) {
+            using Category = typename std::iterator_traits<InputIt>::iterator_category;
+            bool fits = true;
+
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+                // Size known up front: at most one allocation and one bulk copy
+                std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+                if (mode == HeapCapacity::Bounded && size() + count > heapSize) {
+                    count = heapSize > size() ? heapSize - size() : 0;
+                    last = std::next(first, count);
+                    fits = false;
+                }
+                if (heap.size() + count > heap.capacity()) {
+                    std::size_t target = grownCapacity();
+                    heap.reserve(target > heap.size() + count ? target : heap.size() + count);
+                }
+                heap.insert(heap.end(), first, last);
+            } else {
+                for (; first != last; ++first) {
+                    if (full()) {
+                        fits = false;
+                        break;
+                    }
+                    grow();
+                    heap.push_back(*first);
+                }
+            }
+            return fits;
+        }
+
+        /**
+         * Remove the root and refill it with the last element
+         * Precondition: the heap is not empty
+         */
+        T removeTop() {
+            T removeElement = std::move(heap[root]);  // Store the top element to return
+            T last = std::move(heap.back());          // Last element refills the root hole
+            heap.pop_back();
+
+            if (!empty()) {
+                if constexpr (Strategy == PopStrategy::BottomUp) {
+                    heap_sift::siftDownBottomUp<Arity>(data(), size(), 0, std::move(last), comp);
+                } else {
+                    heap_sift::siftDown<Arity>(data(), size(), 0, std::move(last), comp);
+                }
+            }
+            return removeElement;
+        }
+
+    public:
+        /**
+         * Constructor: Initialize the heap with given capacity
+         * For a binary heap this is the classic 1-based layout:
+         * Parent of node i: i/2
+         * Left child of node i: 2*i
+         * Right child of node i: 2*i + 1
+         *
+         * @param capacity: Initial reservation (Growable) or hard limit (Bounded)
+         * @param capacityMode: Whether the heap grows past capacity or rejects inserts
+         * @param compare: Ordering used to arrange the elements
+         */
+        explicit Heap(std::size_t capacity = 0,
+                      HeapCapacity capacityMode = HeapCapacity::Growable,
+                      const Compare& compare = Compare())
+            : heapSize(capacity), mode(capacityMode), comp(compare) {
+            heap.reserve(capacity + root);  // Slots before the root are unused
+            heap.resize(root);
+        }
+
+        /**
+         * Constructor: Build a Growable heap from a range in O(n)
+         * Pass move iterators (std::make_move_iterator) to move the batch in
+         * @param first, last: Range of elements to load
+         * @param compare: Ordering used to arrange the elements
+         */
+        template<typename InputIt,
+                 typename = typename std::iterator_traits<InputIt>::iterator_category>
+        Heap(InputIt first, InputIt last, const Compare& compare = Compare())
+            : comp(compare) {
+            heap.resize(root);
+            assign(first, last);
+        }
+
+        /**
+         * Replace the contents of the heap with a range, then heapify bottom-up
+         * A Bounded heap keeps only as many elements as its limit allows
+         * @param first, last: Range of elements to load (copied, or moved via move iterators)
+         * @return: false if a Bounded heap had to drop part of the range, true otherwise
+         */
+        template<typename InputIt,
+                 typename = typename std::iterator_traits<InputIt>::iterator_category>
+        bool assign(InputIt first, InputIt last) {
+            heap.resize(root);
+            bool fits = append(first, last);
+            heap_sift::heapify<Arity>(data(), size(), comp);
+            return fits;
+        }
+
+        /**
+         * assign, with the heapify spread over a thread pool (see
+         * heap_sift::heapifyParallel); worth it for millions of elements
+         * @param first, last: Range of elements to load
+         * @param pool: Thread pool (e.g. ThreadPool from thread-pool.hpp)
+         * @return: false if a Bounded heap had to drop part of the range, true otherwise
+         */
+        template<typename InputIt, typename Pool,
+                 typename = typename std::iterator_traits<InputIt>::iterator_category>
+        bool assign(InputIt first, InputIt last, Pool& pool) {
+            heap.resize(root);
+            bool fits = append(first, last);
+            heap_sift::heapifyParallel<Arity>(data(), size(), comp, pool);
+            return fits;
+        }
+
+        /**
+         * Add a batch of elements in one call
+         * The batch is appended first; a handful of elements (no more than the
+         * tree height) are then sifted up one by one, larger batches are
+         * merged by re-heapifying only the ancestors of the appended range
+         * A Bounded heap keeps only as many elements as its limit allows
+         * @param first, last: Range of elements to add
+         * @return: false if a Bounded heap had to drop part of the range, true otherwise
+         */
+        template<typename InputIt,
+                 typename = typename std::iterator_traits<InputIt>::iterator_category>
+        bool push_bulk(InputIt first, InputIt last) {
+            const std::size_t lo = size();
+            bool fits = append(first, last);
+
+            std::size_t height = 0;
+            for (std::size_t level = size(); level > 1; level /= Arity) {
+                ++height;
+            }
+            if (size() - lo <= height) {
+                for (std::size_t index = lo; index < size(); ++index) {
+                    heap_sift::siftUp<Arity>(data(), index, std::move(data()[index]), comp);
+                }
+            } else {
+                heap_sift::heapifyAppended<Arity>(data(), size(), lo, comp);
+            }
+            return fits;
+        }
+
+        /**
+         * Add every element of a container or other range in one call
+         * @param range: Anything with begin()/end()
+         * @return: false if a Bounded heap had to drop part of the range, true otherwise
+         */
+        template<typename Range>
+        bool push_bulk(const Range& range) {
+            return push_bulk(std::begin(range), std::end(range));
+        }
+
+        /**
+         * Move every element of other into this heap
+         * The smaller array is appended to the larger one (a Growable heap
+         * adopts other's storage when other holds more elements) and merged
+         * with push_bulk, so melding k into n elements costs O(k + log^2 n)
+         * instead of k pops and adds. Elements a Bounded heap cannot take
+         * stay behind in other, which remains a valid heap.
+         * @param other: Heap with the same ordering; left empty unless this heap is Bounded
+         * @return: false if a Bounded heap could not take every element, true otherwise
+         */
+        bool meld(Heap& other) {
+            if (this == &other || other.empty()) {
+                return true;
+            }
+            if (mode == HeapCapacity::Growable && other.size() > size()) {
+                heap.swap(other.heap);
+            }
+
+            const std::size_t before = size();
+            bool fits = push_bulk(std::make_move_iterator(other.heap.begin() + root),
+                                  std::make_move_iterator(other.heap.end()));
+            const std::size_t taken = size() - before;
+            other.heap.erase(other.heap.begin() + root, other.heap.begin() + root + taken);
+            if (!other.empty()) {
+                heap_sift::heapify<Arity>(other.data(), other.size(), other.comp);
+            }
+            return fits;
+        }
+
+        /**
+         * Move every element of a temporary heap into this heap
+         * @return: false if a Bounded heap could not take every element, true otherwise
+         */
+        bool meld(Heap&& other) {
+            return meld(other);
+        }
+
+        /**
+         * Remove the top k elements, writing them to out in heap order
+         * The emptiness check is done once for the whole batch
+         * @param k: Number of elements to remove (clamped to size())
+         * @param out: Output iterator receiving the removed elements
+         * @return: Number of elements removed
+         */
+        template<typename OutputIt>
+        std::size_t pop_n(std::size_t k, OutputIt out) {
+            if (k > size()) {
+                k = size();
+            }
+            for (std::size_t i = 0; i < k; ++i) {
+                *out = removeTop();
+                ++out;
+            }
+            return k;
+        }
+
+        /**
+         * Add an element to the heap
+         * Maintains the heap property by bubbling up the new element
+         * @param element: Value to be added to the heap
+         * @return: false if a Bounded heap is already full, true otherwise
+         */
+        bool add(const T& element) {
+            if (inStorage(element)) {
+                T copy(element);  // e.g. add(top()): copy before the storage can move
+                return emplace(std::move(copy));
+            }
+            return emplace(element);
+        }
+
+        /**
+         * Add a copy of an element to the heap (same as add)
+         * @return: false if a Bounded heap is already full, true otherwise
+         */
+        bool push(const T& element) {
+            return add(element);
+        }
+
+        /**
+         * Move an element into the heap without copying it
+         * @param element: Value to be moved into the heap
+         * @return: false if a Bounded heap is already full (element is left untouched)
+         */
+        bool push(T&& element) {
+            return emplace(std::move(element));
+        }
+
+        /**
+         * Construct an element in place at the end of the backing store from
+         * args, then bubble it up; the element is only ever moved afterwards
+         * @param args: Constructor arguments for T
+         * @return: false if a Bounded heap is already full (nothing is constructed)
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args) {
+            if (full()) {
+                return false;
+            }
+
+            grow();
+            heap.emplace_back(std::forward<Args>(args)...);
+            heap_sift::siftUp<Arity>(data(), size() - 1, std::move(heap.back()), comp);
+            return true;
+        }
+
+        /**
+         * Access the top element (root) in place, without copying it
+         * Precondition: the heap is not empty
+         * @return: Reference to the top element, valid until the heap is modified
+         */
+        const T& top() const {
+            return heap[root];
+        }
+
+        /**
+         * Peek at the top element (root) without removing it
+         * @return: The top element in the heap, or the empty sentinel if empty
+         */
+        T peek() const {
+            if (empty()) {
+                return heap_sift::emptyValue<T>(comp);
+            }
+            return heap[root];
+        }
+
+        /**
+         * Peek at the top element (root) without removing it
+         * @return: The top element, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_peek() const {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return heap[root];
+        }
+
+        /**
+         * Remove and return the top element from the heap
+         * Maintains the heap property by bubbling down the replacement element
+         * @return: The element that was removed, or the empty sentinel if empty
+         */
+        T pop() {
+            if (empty()) {
+                return heap_sift::emptyValue<T>(comp);
+            }
+            return removeTop();
+        }
+
+        /**
+         * Remove and return the top element from the heap
+         * @return: The element that was removed, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_pop() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeTop();
+        }
+
+        /**
+         * Replace the top element with element and sift it down: one pass
+         * from the root instead of the two a pop followed by an add makes
+         * (e.g. keeping the K best of a stream in a heap of size K)
+         * @param element: Value that takes the place of the top
+         * @return: The element that was replaced, or the empty sentinel if the
+         *          heap was empty (element is then simply added)
+         */
+        T replace_top(T element) {
+            if (empty()) {
+                emplace(std::move(element));
+                return heap_sift::emptyValue<T>(comp);
+            }
+            T replaced = std::move(heap[root]);
+            if constexpr (Strategy == PopStrategy::BottomUp) {
+                heap_sift::siftDownBottomUp<Arity>(data(), size(), 0, std::move(element), comp);
+            } else {
+                heap_sift::siftDown<Arity>(data(), size(), 0, std::move(element), comp);
+            }
+            return replaced;
+        }
+
+        /**
+         * Get the current number of elements in the heap
+         * @return: Number of elements currently stored in the heap
+         */
+        std::size_t size() const {
+            return heap.size() - root;
+        }
+
+        /**
+         * Check whether the heap holds no elements
+         */
+        bool empty() const {
+            return heap.size() == root;
+        }
+
+        /**
+         * Check whether a Bounded heap has reached its limit
+         * A Growable heap is never full
+         */
+        bool full() const {
+            return mode == HeapCapacity::Bounded && size() >= heapSize;
+        }
+
+        /**
+         * Number of elements the heap can hold without reallocating
+         */
+        std::size_t capacity() const {
+            return heap.capacity() - root;
+        }
+
+        /**
+         * Pre-allocate storage for at least n elements
+         * A Bounded heap never reserves beyond its limit
+         * @param n: Number of elements to make room for
+         */
+        void reserve(std::size_t n) {
+            if (mode == HeapCapacity::Bounded && n > heapSize) {
+                n = heapSize;
+            }
+            heap.reserve(n + root);
+        }
+
+        /**
+         * Release storage that is not used by the current elements
+         */
+        void shrink_to_fit() {
+            heap.shrink_to_fit();
+        }
+
+        /**
+         * Set the multiplier applied to the capacity when a Growable heap is full
+         * Factors <= 1 degrade to growing by a single slot per insert; the
+         * grown capacity is capped at max_size()
+         * @param factor: New growth factor (2.0 by default)
+         * @return: false (keeping the current factor) if factor is NaN or infinite
+         */
+        bool setGrowthFactor(double factor) {
+            if (!std::isfinite(factor)) {
+                return false;
+            }
+            growth = factor;
+            return true;
+        }
+
+        /**
+         * Get the multiplier applied to the capacity when a Growable heap is full
+         */
+        double growthFactor() const {
+            return growth;
+        }
+
+        /**
+         * Convert heap to string representation for display
+         * Shows elements in level-order (array representation), which is
+         * NOT sorted order; requires T to support operator<<
+         * @return: String representation of heap elements in array format
+         */
+        std::string toString() const {
+            const std::size_t realSize = size();
+            if (realSize == 0) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            oss << '[';
+            for (std::size_t i = root; i < heap.size(); ++i) {
+                oss << heap[i];
+                if (i + 1 < heap.size()) {
+                    oss << ',';
+                }
+            }
+            oss << ']';
+            return oss.str();
+        }
+};
+
+/**
+ * The classic integer heaps are thin aliases over the generic template
+ */
+using MinHeap = Heap<int, std::less<int>>;
+using MaxHeap = Heap<int, std::greater<int>>;
+
+/**
+ * d-ary heap sibling of MinHeap/MaxHeap with the same API
+ * D children per node; pick D so that D * sizeof(T) fits a 64-byte line
+ */
+template<typename T, std::size_t D, typename Compare = std::less<T>,
+         typename Allocator = CacheAlignedAllocator<T>>
+using DaryHeap = Heap<T, Compare, HeapStorage<T, Allocator>, PopStrategy::TopDown, D>;
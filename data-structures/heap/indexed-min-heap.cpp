@@ -0,0 +1,67 @@
+/**
+ * IndexedMinHeap Demonstration in C++
+ *
+ * Runs Prim's minimum spanning tree on a small undirected graph. Vertex ids
+ * are the heap keys, so the best known edge weight of a vertex is lowered in
+ * place with change_priority, and contains() tells whether a vertex is still
+ * outside the tree.
+ */
+
+#include<iostream>
+#include<vector>
+#include "indexed-min-heap.hpp"
+using namespace std;
+
+int main() {
+    // Undirected weighted graph as adjacency lists of (neighbour, weight)
+    vector<vector<pair<int, int>>> graph = {
+        {{1, 4}, {2, 3}},           // 0
+        {{0, 4}, {2, 1}, {3, 2}},   // 1
+        {{0, 3}, {1, 1}, {3, 4}},   // 2
+        {{1, 2}, {2, 4}, {4, 2}},   // 3
+        {{3, 2}}                    // 4
+    };
+    const int vertices = static_cast<int>(graph.size());
+
+    IndexedMinHeap<int> queue(vertices);
+    vector<int> parent(vertices, -1);
+    vector<bool> inTree(vertices, false);
+    queue.push(0, 0);
+
+    int total = 0;
+    while (!queue.empty()) {
+        int weight = queue.top_priority();
+        int u = queue.pop();
+        total += weight;
+        if (parent[u] != -1) {
+            cout << "Tree edge " << parent[u] << " - " << u << " (weight " << weight << ")" << endl;
+        }
+        inTree[u] = true;
+
+        for (auto [v, w] : graph[u]) {
+            if (inTree[v]) {
+                continue;
+            }
+            if (!queue.contains(v)) {
+                queue.push(v, w);
+                parent[v] = u;
+            } else if (w < queue.priority(v)) {
+                queue.change_priority(v, w);
+                parent[v] = u;
+            }
+        }
+        cout << "Queue: " << queue.toString() << endl;
+    }
+    cout << "Total weight of the spanning tree: " << total << endl;
+
+    // remove() takes an arbitrary vertex out of the queue
+    IndexedMinHeap<int> pending(vertices);
+    for (int v = 0; v < vertices; ++v) {
+        pending.push(v, 10 - v);
+    }
+    pending.remove(4);
+    cout << "After removing vertex 4: " << pending.toString()
+         << ", contains(4) = " << pending.contains(4) << endl;
+
+    return 0;
+}
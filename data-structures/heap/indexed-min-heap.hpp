@@ -0,0 +1,256 @@
+/**
+ * Indexed Min-Heap Implementation in C++
+ *
+ * An indexed priority queue over dense integer keys 0..V-1 (vertex ids in
+ * graph algorithms). Instead of handles and a hash map, positions live in a
+ * flat array indexed by key id, so every lookup is a single load:
+ * - heap[slot]   = id stored in that slot (heap order)
+ * - pos[id]      = slot holding id, or -1 when id is not in the heap
+ * - priority[id] = current priority of id
+ *
+ * Memory is exactly two ints per id (heap and pos) plus one Priority per id,
+ * all allocated once in the constructor. The heap orders ids by their
+ * priorities using the same sift kernels as MinHeap (heap-sift.hpp), whose
+ * placement callback keeps pos[] current inside the sift loops.
+ *
+ * Time Complexities:
+ * - push / pop / change_priority / remove: O(log n)
+ * - contains / top / priority: O(1)
+ *
+ * Space Complexity: O(V)
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<functional>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<utility>
+#include<vector>
+#include "heap-sift.hpp"
+
+template<typename Priority = int, typename Compare = std::less<Priority>, std::size_t Arity = 2>
+class IndexedMinHeap {
+    static_assert(Arity >= 2, "A heap node needs at least two children");
+
+    private:
+        /**
+         * Orders ids by their current priorities
+         */
+        struct IdCompare {
+            const Priority* priority;
+            Compare comp;
+
+            bool operator()(int a, int b) const {
+                return comp(priority[a], priority[b]);
+            }
+        };
+
+        std::vector<int> heap;             // Ids in heap order
+        std::vector<int> pos;              // Slot of each id, -1 if absent
+        std::vector<Priority> priorities;  // Priority of each id
+        int realSize = 0;                  // Current number of ids in the heap
+        IdCompare comp;
+
+        /**
+         * Placement callback for the sift kernels: records where each id lands
+         */
+        auto tracker() {
+            int* ids = heap.data();
+            int* slots = pos.data();
+            return [ids, slots](std::size_t index) {
+                slots[ids[index]] = static_cast<int>(index);
+            };
+        }
+
+        /**
+         * Move the id at index up or down until the heap property holds
+         */
+        void restore(std::size_t index) {
+            if (index > 0 && comp(heap[index], heap[heap_sift::parentOf<Arity>(index)])) {
+                heap_sift::siftUp<Arity>(heap.data(), index, heap[index], comp, tracker());
+            } else {
+                heap_sift::siftDown<Arity>(heap.data(), realSize, index, heap[index], comp, tracker());
+            }
+        }
+
+        /**
+         * Remove the id at index and return it
+         */
+        int removeAt(std::size_t index) {
+            int id = heap[index];
+            pos[id] = -1;
+            realSize--;
+            if (index < static_cast<std::size_t>(realSize)) {
+                heap[index] = heap[realSize];
+                pos[heap[index]] = static_cast<int>(index);
+                restore(index);
+            }
+            return id;
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty heap for ids 0..capacity-1
+         * @param capacity: Number of distinct ids (V)
+         * @param compare: Ordering of priorities
+         */
+        explicit IndexedMinHeap(int capacity, const Compare& compare = Compare())
+            : heap(capacity), pos(capacity, -1), priorities(capacity), comp{nullptr, compare} {
+            comp.priority = priorities.data();
+        }
+
+        IndexedMinHeap(const IndexedMinHeap& other)
+            : heap(other.heap), pos(other.pos), priorities(other.priorities),
+              realSize(other.realSize), comp{nullptr, other.comp.comp} {
+            comp.priority = priorities.data();
+        }
+
+        IndexedMinHeap& operator=(const IndexedMinHeap& other) {
+            if (this != &other) {
+                heap = other.heap;
+                pos = other.pos;
+                priorities = other.priorities;
+                realSize = other.realSize;
+                comp = IdCompare{priorities.data(), other.comp.comp};
+            }
+            return *this;
+        }
+
+        /**
+         * Insert an id with a priority
+         * @param id: Key in 0..capacity-1
+         * @param priority: Priority of id
+         * @return: false if id is out of range or already in the heap
+         */
+        bool push(int id, Priority priority) {
+            if (id < 0 || id >= capacity() || pos[id] != -1) {
+                return false;
+            }
+            priorities[id] = std::move(priority);
+            heap[realSize] = id;
+            realSize++;
+            heap_sift::siftUp<Arity>(heap.data(), realSize - 1, id, comp, tracker());
+            return true;
+        }
+
+        /**
+         * Check whether an id is currently in the heap
+         */
+        bool contains(int id) const {
+            return id >= 0 && id < capacity() && pos[id] != -1;
+        }
+
+        /**
+         * Change the priority of an id already in the heap, in either direction
+         * Precondition: contains(id)
+         * @param id: Key whose priority changes
+         * @param priority: New priority
+         */
+        void change_priority(int id, Priority priority) {
+            priorities[id] = std::move(priority);
+            restore(pos[id]);
+        }
+
+        /**
+         * Remove an id wherever it sits in the heap
+         * Precondition: contains(id)
+         */
+        void remove(int id) {
+            removeAt(pos[id]);
+        }
+
+        /**
+         * Priority last assigned to an id (still readable after it was popped)
+         */
+        const Priority& priority(int id) const {
+            return priorities[id];
+        }
+
+        /**
+         * Id with the best priority
+         * Precondition: the heap is not empty
+         */
+        int top() const {
+            return heap[0];
+        }
+
+        /**
+         * Priority of the top id
+         * Precondition: the heap is not empty
+         */
+        const Priority& top_priority() const {
+            return priorities[heap[0]];
+        }
+
+        /**
+         * Peek at the id with the best priority
+         * @return: The top id, or -1 if empty
+         */
+        int peek() const {
+            return empty() ? -1 : top();
+        }
+
+        /**
+         * Remove and return the id with the best priority
+         * @return: The removed id, or -1 if empty
+         */
+        int pop() {
+            return empty() ? -1 : removeAt(0);
+        }
+
+        /**
+         * Remove and return the id with the best priority
+         * @return: The removed id, or std::nullopt if the heap is empty
+         */
+        std::optional<int> try_pop() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeAt(0);
+        }
+
+        /**
+         * Get the current number of ids in the heap
+         */
+        std::size_t size() const {
+            return static_cast<std::size_t>(realSize);
+        }
+
+        /**
+         * Check whether the heap holds no ids
+         */
+        bool empty() const {
+            return realSize == 0;
+        }
+
+        /**
+         * Number of distinct ids the heap was built for (V)
+         */
+        int capacity() const {
+            return static_cast<int>(pos.size());
+        }
+
+        /**
+         * Convert heap to string representation for display
+         * Shows id:priority pairs in level order
+         */
+        std::string toString() const {
+            if (realSize == 0) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            oss << '[';
+            for (int i = 0; i < realSize; ++i) {
+                oss << heap[i] << ':' << priorities[heap[i]];
+                if (i < realSize - 1) {
+                    oss << ',';
+                }
+            }
+            oss << ']';
+            return oss.str();
+        }
+};
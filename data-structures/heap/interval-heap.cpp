@@ -0,0 +1,36 @@
+/**
+ * IntervalHeap Demonstration in C++
+ *
+ * Keeps a bounded window of the K best scores from a stream: once the
+ * window is full, every new score evicts the worst one (pop_min), while the
+ * best score (peek_max) stays available at the other end.
+ */
+
+#include<iostream>
+#include<vector>
+#include "interval-heap.hpp"
+using namespace std;
+
+int main() {
+    const size_t K = 4;
+    IntervalHeap<int> window(K + 1);
+
+    vector<int> scores = {40, 75, 12, 88, 63, 91, 27, 70, 55};
+    for (int score : scores) {
+        window.add(score);
+        if (window.size() > K) {
+            cout << "Evicted " << window.pop_min() << "; ";
+        }
+        cout << "window " << window.toString() << ", best " << window.peek_max()
+             << ", worst kept " << window.peek_min() << endl;
+    }
+
+    // Drain best first
+    cout << "Top " << K << ":";
+    while (auto best = window.try_pop_max()) {
+        cout << " " << *best;
+    }
+    cout << endl;
+
+    return 0;
+}
@@ -0,0 +1,399 @@
+/**
+ * Interval Heap Implementation in C++
+ *
+ * A double-ended priority queue that stores two elements per node: node k
+ * holds the interval [lo, hi] in slots 2k and 2k+1 of one flat array, and
+ * every node's interval contains the intervals of its children. The lo
+ * ends form a min-heap and the hi ends a max-heap, so:
+ * - the minimum is slot 0 and the maximum is slot 1
+ * - push adds to the last node and bubbles up on the side it falls outside of
+ * - pop_min / pop_max refill the root end with the last element and
+ *   trickle it down that side, swapping it with the node's other end when
+ *   it crosses over
+ *
+ * Compared with the min-max heap, a node is two adjacent elements, so the
+ * tree has half as many levels and each level visited costs one cache line
+ * for both ends; compared with separate MinHeap and MaxHeap copies, there
+ * is one copy of the data and no lazy-deletion bookkeeping.
+ *
+ * Template parameters follow Heap: T, Compare (comp(a, b) == true means a is
+ * nearer the min end) and Container, the backing random-access storage.
+ * The last node may hold a single element, which then acts as both ends.
+ *
+ * Time Complexities:
+ * - push / pop_min / pop_max: O(log n)
+ * - peek_min / peek_max: O(1)
+ * - Build from a range: O(n log n)
+ *
+ * Space Complexity: O(n)
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<functional>
+#include<iterator>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<utility>
+#include<vector>
+#include "heap-sift.hpp"
+#include "heap.hpp"
+
+template<typename T, typename Compare = std::less<T>, typename Container = HeapStorage<T>>
+class IntervalHeap {
+    private:
+        Container heap;  // Node k holds lo at 2k and hi at 2k+1
+        Compare comp;
+
+        static std::size_t parentOf(std::size_t node) {
+            return (node - 1) / 2;
+        }
+
+        /**
+         * Slot of the hi end of node: its second slot, or its only one
+         */
+        std::size_t hiSlot(std::size_t node) const {
+            return 2 * node + 1 < heap.size() ? 2 * node + 1 : 2 * node;
+        }
+
+        /**
+         * Move the hole at slot (in node) up the lo ends while value is smaller
+         */
+        void bubbleUpMin(std::size_t slot, std::size_t node, T value) {
+            while (node > 0) {
+                std::size_t parent = parentOf(node);
+                if (!comp(value, heap[2 * parent])) {
+                    break;
+                }
+                heap[slot] = std::move(heap[2 * parent]);
+                slot = 2 * parent;
+                node = parent;
+            }
+            heap[slot] = std::move(value);
+        }
+
+        /**
+         * Move the hole at slot (in node) up the hi ends while value is larger
+         */
+        void bubbleUpMax(std::size_t slot, std::size_t node, T value) {
+            while (node > 0) {
+                std::size_t parent = parentOf(node);
+                if (!comp(heap[2 * parent + 1], value)) {
+                    break;
+                }
+                heap[slot] = std::move(heap[2 * parent + 1]);
+                slot = 2 * parent + 1;
+                node = parent;
+            }
+            heap[slot] = std::move(value);
+        }
+
+        /**
+         * Insert value, coming from the hole in the last slot
+         */
+        void bubbleUp(T value) {
+            const std::size_t slot = heap.size() - 1;
+            const std::size_t node = slot / 2;
+            if (slot % 2 == 1) {
+                // Second element of the last node: order the pair first
+                if (comp(value, heap[slot - 1])) {
+                    heap[slot] = std::move(heap[slot - 1]);
+                    bubbleUpMin(slot - 1, node, std::move(value));
+                } else {
+                    bubbleUpMax(slot, node, std::move(value));
+                }
+                return;
+            }
+            if (node > 0) {
+                std::size_t parent = parentOf(node);
+                if (comp(value, heap[2 * parent])) {
+                    bubbleUpMin(slot, node, std::move(value));
+                    return;
+                }
+                if (comp(heap[2 * parent + 1], value)) {
+                    bubbleUpMax(slot, node, std::move(value));
+                    return;
+                }
+            }
+            heap[slot] = std::move(value);
+        }
+
+        /**
+         * Drop value into the hole at the lo end of the root and move the
+         * hole down the lo ends
+         */
+        void trickleDownMin(T value) {
+            const std::size_t size = heap.size();
+            std::size_t node = 0;
+            while (true) {
+                if (2 * node + 1 < size && comp(heap[2 * node + 1], value)) {
+                    std::swap(value, heap[2 * node + 1]);  // Crossed over the hi end
+                }
+                std::size_t child = 2 * node + 1;
+                if (2 * child >= size) {
+                    break;
+                }
+                if (2 * (child + 1) < size && comp(heap[2 * (child + 1)], heap[2 * child])) {
+                    ++child;
+                }
+                if (!comp(heap[2 * child], value)) {
+                    break;
+                }
+                heap[2 * node] = std::move(heap[2 * child]);
+                node = child;
+            }
+            heap[2 * node] = std::move(value);
+        }
+
+        /**
+         * Drop value into the hole at the hi end of the root and move the
+         * hole down the hi ends
+         */
+        void trickleDownMax(T value) {
+            const std::size_t size = heap.size();
+            std::size_t node = 0;
+            std::size_t slot = 1;
+            while (true) {
+                if (slot == 2 * node + 1 && comp(value, heap[2 * node])) {
+                    std::swap(value, heap[2 * node]);  // Crossed over the lo end
+                }
+                std::size_t child = 2 * node + 1;
+                if (slot == 2 * node || 2 * child >= size) {
+                    break;  // A single-element node is the last one: no children
+                }
+                if (2 * (child + 1) < size && comp(heap[hiSlot(child)], heap[hiSlot(child + 1)])) {
+                    ++child;
+                }
+                std::size_t childSlot = hiSlot(child);
+                if (!comp(value, heap[childSlot])) {
+                    break;
+                }
+                heap[slot] = std::move(heap[childSlot]);
+                slot = childSlot;
+                node = child;
+            }
+            heap[slot] = std::move(value);
+        }
+
+        T removeMin() {
+            T removed = std::move(heap[0]);
+            T last = std::move(heap.back());
+            heap.pop_back();
+            if (!heap.empty()) {
+                trickleDownMin(std::move(last));
+            }
+            return removed;
+        }
+
+        T removeMax() {
+            if (heap.size() <= 2) {
+                T removed = std::move(heap.back());  // The root holds the only elements
+                heap.pop_back();
+                return removed;
+            }
+            T removed = std::move(heap[1]);
+            T last = std::move(heap.back());
+            heap.pop_back();
+            trickleDownMax(std::move(last));
+            return removed;
+        }
+
+        T emptyMin() const {
+            return heap_sift::emptyValue<T>(comp);
+        }
+
+        T emptyMax() const {
+            const Compare& order = comp;
+            return heap_sift::emptyValue<T>([&order](const T& a, const T& b) { return order(b, a); });
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty heap
+         * @param capacity: Number of elements to reserve room for
+         * @param compare: Ordering; comp(a, b) means a is nearer the min end
+         */
+        explicit IntervalHeap(std::size_t capacity = 0, const Compare& compare = Compare())
+            : comp(compare) {
+            heap.reserve(capacity);
+        }
+
+        /**
+         * Constructor: Build a heap from a range
+         * @param first, last: Range of elements to load
+         * @param compare: Ordering; comp(a, b) means a is nearer the min end
+         */
+        template<typename InputIt,
+                 typename = typename std::iterator_traits<InputIt>::iterator_category>
+        IntervalHeap(InputIt first, InputIt last, const Compare& compare = Compare())
+            : comp(compare) {
+            for (; first != last; ++first) {
+                push(*first);
+            }
+        }
+
+        /**
+         * Add an element to the heap
+         * @param element: Value to be added
+         * @return: Always true; the heap grows on demand
+         */
+        bool add(const T& element) {
+            heap.push_back(element);  // push_back copes with element living in heap
+            bubbleUp(std::move(heap.back()));
+            return true;
+        }
+
+        /**
+         * Add a copy of an element (same as add)
+         */
+        bool push(const T& element) {
+            return add(element);
+        }
+
+        /**
+         * Move an element into the heap
+         */
+        bool push(T&& element) {
+            return emplace(std::move(element));
+        }
+
+        /**
+         * Construct an element from args and insert it
+         * @param args: Constructor arguments for T
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args) {
+            heap.emplace_back(std::forward<Args>(args)...);
+            bubbleUp(std::move(heap.back()));
+            return true;
+        }
+
+        /**
+         * Access the element at the min end in place
+         * Precondition: the heap is not empty
+         */
+        const T& top_min() const {
+            return heap[0];
+        }
+
+        /**
+         * Access the element at the max end in place
+         * Precondition: the heap is not empty
+         */
+        const T& top_max() const {
+            return heap[heap.size() > 1 ? 1 : 0];
+        }
+
+        /**
+         * Peek at the minimum
+         * @return: The minimum, or the empty sentinel (the value that loses as a minimum) if empty
+         */
+        T peek_min() const {
+            return empty() ? emptyMin() : top_min();
+        }
+
+        /**
+         * Peek at the maximum
+         * @return: The maximum, or the empty sentinel (the value that loses as a maximum) if empty
+         */
+        T peek_max() const {
+            return empty() ? emptyMax() : top_max();
+        }
+
+        /**
+         * Remove and return the minimum
+         * @return: The removed element, or the empty sentinel if empty
+         */
+        T pop_min() {
+            return empty() ? emptyMin() : removeMin();
+        }
+
+        /**
+         * Remove and return the maximum
+         * @return: The removed element, or the empty sentinel if empty
+         */
+        T pop_max() {
+            return empty() ? emptyMax() : removeMax();
+        }
+
+        /**
+         * Peek at the minimum
+         * @return: The minimum, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_peek_min() const {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return top_min();
+        }
+
+        /**
+         * Peek at the maximum
+         * @return: The maximum, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_peek_max() const {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return top_max();
+        }
+
+        /**
+         * Remove and return the minimum
+         * @return: The removed element, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_pop_min() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeMin();
+        }
+
+        /**
+         * Remove and return the maximum
+         * @return: The removed element, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_pop_max() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeMax();
+        }
+
+        /**
+         * Get the current number of elements in the heap
+         */
+        std::size_t size() const {
+            return heap.size();
+        }
+
+        /**
+         * Check whether the heap holds no elements
+         */
+        bool empty() const {
+            return heap.empty();
+        }
+
+        /**
+         * Convert heap to string representation for display: one [lo,hi]
+         * interval per node, in level order
+         * Requires T to support operator<<
+         */
+        std::string toString() const {
+            if (empty()) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            for (std::size_t slot = 0; slot < heap.size(); slot += 2) {
+                oss << '[' << heap[slot];
+                if (slot + 1 < heap.size()) {
+                    oss << ',' << heap[slot + 1];
+                }
+                oss << ']';
+            }
+            return oss.str();
+        }
+};
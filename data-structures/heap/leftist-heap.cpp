@@ -0,0 +1,40 @@
+/**
+ * LeftistHeap Demonstration in C++
+ *
+ * Models per-worker task queues that are periodically rebalanced: each
+ * shard is a leftist heap, and merging two shards is a single O(log n) meld
+ * instead of popping one queue into the other.
+ */
+
+#include<iostream>
+#include<vector>
+#include "leftist-heap.hpp"
+using namespace std;
+
+int main() {
+    // Step 1: Fill two shards with task priorities
+    LeftistHeap<int> shardA;
+    LeftistHeap<int> shardB;
+    for (int priority : {7, 3, 9, 1}) {
+        shardA.add(priority);
+    }
+    for (int priority : {8, 2, 6}) {
+        shardB.add(priority);
+    }
+    cout << "Shard A: " << shardA.toString() << endl;
+    cout << "Shard B: " << shardB.toString() << endl;
+
+    // Step 2: Worker B goes idle; hand its queue to worker A
+    shardA.meld(shardB);
+    cout << "After meld: " << shardA.toString() << " (" << shardA.size()
+         << " tasks), shard B empty = " << shardB.empty() << endl;
+
+    // Step 3: Drain in priority order
+    cout << "Popped:";
+    while (auto priority = shardA.try_pop()) {
+        cout << " " << *priority;
+    }
+    cout << endl;
+
+    return 0;
+}
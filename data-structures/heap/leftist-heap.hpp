@@ -0,0 +1,330 @@
+/**
+ * Leftist Heap Implementation in C++
+ *
+ * A heap-ordered binary tree in which every node's left subtree is at least
+ * as "deep" as its right one, measured by the rank (s-value): the length of
+ * the shortest path down to a missing child. The right spine therefore holds
+ * at most log2(n+1) nodes, and every operation is a merge of two right spines:
+ * - meld:  merge the right spines in key order, then walk back up swapping
+ *          children wherever the left rank fell below the right one
+ * - push:  meld with a single-node heap
+ * - pop:   meld the two subtrees of the root
+ *
+ * Unlike the array-backed Heap, melding two leftist heaps never touches the
+ * bulk of either tree, which makes it the structure of choice for queues
+ * that are merged often (e.g. rebalancing work queues between shards).
+ * Nodes come from a NodePool; meld adopts the other heap's pool in O(chunks).
+ * The merge is iterative, so deep trees cannot overflow the call stack.
+ *
+ * Time Complexities (worst case):
+ * - meld / push / pop: O(log n)
+ * - top / peek: O(1)
+ *
+ * Space Complexity: O(n), two pointers and a rank per element
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<functional>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<utility>
+#include<vector>
+#include "heap-sift.hpp"
+#include "node-pool.hpp"
+
+template<typename T, typename Compare = std::less<T>>
+class LeftistHeap {
+    private:
+        struct Node {
+            T value;
+            Node* left = nullptr;
+            Node* right = nullptr;
+            std::size_t rank = 1;  // Shortest distance to a missing child
+
+            template<typename... Args>
+            explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {}
+        };
+
+        NodePool<Node> pool;
+        Node* root = nullptr;
+        std::size_t count = 0;
+        Compare comp;
+
+        static std::size_t rankOf(const Node* node) {
+            return node != nullptr ? node->rank : 0;
+        }
+
+        /**
+         * Merge two leftist trees along their right spines
+         * Each spine holds at most 64 nodes (n < 2^64), so the path fits on the stack
+         */
+        Node* merge(Node* a, Node* b) {
+            if (a == nullptr) {
+                return b;
+            }
+            if (b == nullptr) {
+                return a;
+            }
+            if (comp(b->value, a->value)) {
+                std::swap(a, b);
+            }
+
+            Node* path[128];
+            std::size_t depth = 0;
+            Node* result = a;
+            while (true) {
+                path[depth++] = a;
+                if (a->right == nullptr) {
+                    a->right = b;
+                    break;
+                }
+                if (comp(b->value, a->right->value)) {
+                    std::swap(a->right, b);  // The winner continues the spine
+                }
+                a = a->right;
+            }
+
+            // Restore the leftist property on the way back up
+            while (depth > 0) {
+                Node* node = path[--depth];
+                if (rankOf(node->left) < rankOf(node->right)) {
+                    std::swap(node->left, node->right);
+                }
+                node->rank = rankOf(node->right) + 1;
+            }
+            return result;
+        }
+
+        template<typename... Args>
+        void insert(Args&&... args) {
+            root = merge(root, pool.create(std::forward<Args>(args)...));
+            count++;
+        }
+
+        T removeTop() {
+            Node* old = root;
+            root = merge(old->left, old->right);
+            T value = std::move(old->value);
+            pool.destroy(old);
+            count--;
+            return value;
+        }
+
+        /**
+         * Destroy every node by rotating left children into the right chain,
+         * so no recursion or stack is needed
+         */
+        void clear() {
+            Node* node = root;
+            while (node != nullptr) {
+                if (node->left != nullptr) {
+                    Node* left = node->left;
+                    node->left = left->right;
+                    left->right = node;
+                    node = left;
+                } else {
+                    Node* next = node->right;
+                    pool.destroy(node);
+                    node = next;
+                }
+            }
+            root = nullptr;
+            count = 0;
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty heap
+         * @param capacity: Accepted for API parity with Heap; nodes are pooled on demand
+         * @param compare: Ordering used to arrange the elements
+         */
+        explicit LeftistHeap(std::size_t capacity = 0, const Compare& compare = Compare())
+            : comp(compare) {
+            (void)capacity;
+        }
+
+        LeftistHeap(const LeftistHeap&) = delete;
+        LeftistHeap& operator=(const LeftistHeap&) = delete;
+
+        LeftistHeap(LeftistHeap&& other) noexcept
+            : pool(std::move(other.pool)), root(other.root), count(other.count),
+              comp(std::move(other.comp)) {
+            other.root = nullptr;
+            other.count = 0;
+        }
+
+        LeftistHeap& operator=(LeftistHeap&& other) noexcept {
+            if (this != &other) {
+                clear();
+                pool = std::move(other.pool);
+                root = other.root;
+                count = other.count;
+                comp = std::move(other.comp);
+                other.root = nullptr;
+                other.count = 0;
+            }
+            return *this;
+        }
+
+        ~LeftistHeap() {
+            clear();
+        }
+
+        /**
+         * Insert an element
+         * @param element: Value to be added to the heap
+         * @return: Always true; a leftist heap is never full
+         */
+        bool add(const T& element) {
+            insert(element);
+            return true;
+        }
+
+        /**
+         * Insert an element by copy (same as add)
+         */
+        bool push(const T& element) {
+            return add(element);
+        }
+
+        /**
+         * Insert an element by move
+         */
+        bool push(T&& element) {
+            insert(std::move(element));
+            return true;
+        }
+
+        /**
+         * Construct an element in place and insert it
+         * @param args: Constructor arguments for T
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args) {
+            insert(std::forward<Args>(args)...);
+            return true;
+        }
+
+        /**
+         * Move every element of other into this heap in O(log n), leaving other empty
+         * @param other: Heap with the same ordering
+         * @return: Always true, for API parity with Heap::meld
+         */
+        bool meld(LeftistHeap& other) {
+            if (this == &other) {
+                return true;
+            }
+            pool.splice(other.pool);
+            root = merge(root, other.root);
+            count += other.count;
+            other.root = nullptr;
+            other.count = 0;
+            return true;
+        }
+
+        /**
+         * Move every element of a temporary heap into this heap
+         */
+        bool meld(LeftistHeap&& other) {
+            return meld(other);
+        }
+
+        /**
+         * Access the top element in place
+         * Precondition: the heap is not empty
+         */
+        const T& top() const {
+            return root->value;
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The top element, or the empty sentinel if empty
+         */
+        T peek() const {
+            if (empty()) {
+                return heap_sift::emptyValue<T>(comp);
+            }
+            return top();
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The top element, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_peek() const {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return top();
+        }
+
+        /**
+         * Remove and return the top element
+         * @return: The element that was removed, or the empty sentinel if empty
+         */
+        T pop() {
+            if (empty()) {
+                return heap_sift::emptyValue<T>(comp);
+            }
+            return removeTop();
+        }
+
+        /**
+         * Remove and return the top element
+         * @return: The element that was removed, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_pop() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeTop();
+        }
+
+        /**
+         * Get the current number of elements in the heap
+         */
+        std::size_t size() const {
+            return count;
+        }
+
+        /**
+         * Check whether the heap holds no elements
+         */
+        bool empty() const {
+            return count == 0;
+        }
+
+        /**
+         * Convert heap to string representation for display (preorder:
+         * node, left subtree, right subtree)
+         * Requires T to support operator<<
+         */
+        std::string toString() const {
+            if (empty()) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            oss << '[';
+            std::vector<const Node*> pending = {root};
+            bool first = true;
+            while (!pending.empty()) {
+                const Node* node = pending.back();
+                pending.pop_back();
+                oss << (first ? "" : ",") << node->value;
+                first = false;
+                if (node->right != nullptr) {
+                    pending.push_back(node->right);
+                }
+                if (node->left != nullptr) {
+                    pending.push_back(node->left);
+                }
+            }
+            oss << ']';
+            return oss.str();
+        }
+};
@@ -0,0 +1,40 @@
+/**
+ * MinMaxHeap Demonstration in C++
+ *
+ * Keeps the resting bid prices of an order book in one min-max heap, so the
+ * lowest and the highest bid are both available without a second copy of
+ * the data in a separate MinHeap and MaxHeap.
+ */
+
+#include<iostream>
+#include<vector>
+#include "min-max-heap.hpp"
+using namespace std;
+
+int main() {
+    // Step 1: Build from the opening book in O(n)
+    vector<int> bids = {101, 97, 105, 99, 103, 98};
+    MinMaxHeap<int> book(bids.begin(), bids.end());
+    cout << "Book: " << book.toString() << endl;
+    cout << "Lowest bid: " << book.peek_min() << ", highest bid: " << book.peek_max() << endl;
+
+    // Step 2: New bids arrive
+    book.add(107);
+    book.add(95);
+    cout << "After adding 107 and 95: lowest " << book.peek_min() << ", highest " << book.peek_max() << endl;
+
+    // Step 3: The highest bid is filled, the lowest one is cancelled
+    cout << "Filled " << book.pop_max() << ", cancelled " << book.pop_min() << endl;
+
+    // Step 4: Drain from both ends at once
+    cout << "Remaining from both ends:";
+    while (!book.empty()) {
+        cout << " " << book.pop_min();
+        if (auto high = book.try_pop_max()) {
+            cout << " " << *high;
+        }
+    }
+    cout << endl;
+
+    return 0;
+}
@@ -0,0 +1,392 @@
+/**
+ * Min-Max Heap Implementation in C++
+ *
+ * A double-ended priority queue in a single array (Atkinson et al., 1986):
+ * a complete binary tree whose levels alternate between min levels (even
+ * depths, starting with the root) and max levels (odd depths).
+ * - a node on a min level is <= every element of its subtree
+ * - a node on a max level is >= every element of its subtree
+ * So the minimum is the root and the maximum is the larger of its two
+ * children, and both ends are served from one copy of the data instead of
+ * a MinHeap and a MaxHeap kept side by side.
+ *
+ * Layout is the plain 0-based one: children of i are 2i+1 and 2i+2. Like
+ * Heap, the sift loops move a hole and write the travelling element once:
+ * - push:    bubble up along grandparents on the min or max levels,
+ *            depending on how the new element compares with its parent
+ * - pop_min/pop_max: refill the root (or the max child) with the last
+ *            element and trickle it down, comparing against children and
+ *            grandchildren
+ *
+ * "min" and "max" follow Compare: comp(a, b) == true means a is nearer the
+ * min end, so with std::greater the roles are swapped.
+ *
+ * Time Complexities:
+ * - push / pop_min / pop_max: O(log n)
+ * - peek_min / peek_max: O(1)
+ * - Build from a range: O(n)
+ *
+ * Space Complexity: O(n)
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<functional>
+#include<iterator>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<utility>
+#include<vector>
+#include "aligned-allocator.hpp"
+#include "heap-sift.hpp"
+
+template<typename T, typename Compare = std::less<T>>
+class MinMaxHeap {
+    private:
+        std::vector<T, CacheAlignedAllocator<T>> heap;  // Level order, root at index 0
+        Compare comp;
+
+        /**
+         * Ordering of a level: on min levels a beats b when it is smaller,
+         * on max levels when it is larger
+         */
+        template<bool MaxLevel>
+        bool beats(const T& a, const T& b) const {
+            if constexpr (MaxLevel) {
+                return comp(b, a);
+            } else {
+                return comp(a, b);
+            }
+        }
+
+        static bool onMaxLevel(std::size_t index) {
+            unsigned depth = 0;
+            for (std::size_t level = index + 1; level > 1; level >>= 1) {
+                ++depth;
+            }
+            return depth % 2 == 1;
+        }
+
+        /**
+         * Move the hole at index up through grandparents on levels of the
+         * given kind while value beats them, then drop value in
+         */
+        template<bool MaxLevel>
+        void bubbleUpGrandparents(std::size_t index, T value) {
+            while (index > 2) {
+                std::size_t grandparent = (index - 3) / 4;
+                if (!beats<MaxLevel>(value, heap[grandparent])) {
+                    break;
+                }
+                heap[index] = std::move(heap[grandparent]);
+                index = grandparent;
+            }
+            heap[index] = std::move(value);
+        }
+
+        /**
+         * Place value, coming from the hole at index (the last slot), on
+         * the correct level kind and bubble it up
+         */
+        void bubbleUp(std::size_t index, T value) {
+            if (index == 0) {
+                heap[0] = std::move(value);
+                return;
+            }
+            std::size_t parent = (index - 1) / 2;
+            if (onMaxLevel(index)) {
+                if (comp(value, heap[parent])) {
+                    // Smaller than its min-level parent: belongs on the min levels
+                    heap[index] = std::move(heap[parent]);
+                    bubbleUpGrandparents<false>(parent, std::move(value));
+                } else {
+                    bubbleUpGrandparents<true>(index, std::move(value));
+                }
+            } else {
+                if (comp(heap[parent], value)) {
+                    // Larger than its max-level parent: belongs on the max levels
+                    heap[index] = std::move(heap[parent]);
+                    bubbleUpGrandparents<true>(parent, std::move(value));
+                } else {
+                    bubbleUpGrandparents<false>(index, std::move(value));
+                }
+            }
+        }
+
+        /**
+         * Drop value into the hole at index, a node on a level of the given
+         * kind, and move the hole down until value fits
+         */
+        template<bool MaxLevel>
+        void trickleDown(std::size_t index, T value) {
+            const std::size_t size = heap.size();
+            while (true) {
+                std::size_t child = 2 * index + 1;
+                if (child >= size) {
+                    break;
+                }
+
+                // Best of the (up to) two children and four grandchildren
+                std::size_t best = child;
+                if (child + 1 < size && beats<MaxLevel>(heap[child + 1], heap[best])) {
+                    best = child + 1;
+                }
+                std::size_t grandchild = 2 * child + 1;
+                std::size_t lastGrandchild = grandchild + 4 < size ? grandchild + 4 : size;
+                bool isGrandchild = false;
+                for (; grandchild < lastGrandchild; ++grandchild) {
+                    if (beats<MaxLevel>(heap[grandchild], heap[best])) {
+                        best = grandchild;
+                        isGrandchild = true;
+                    }
+                }
+
+                if (!beats<MaxLevel>(heap[best], value)) {
+                    break;  // value already beats everything below it
+                }
+                heap[index] = std::move(heap[best]);
+                index = best;
+                if (!isGrandchild) {
+                    break;  // best is on the opposite level kind and value beats it there, so it beats its subtree
+                }
+                std::size_t parent = (best - 1) / 2;  // On the opposite level kind
+                if (beats<!MaxLevel>(value, heap[parent])) {
+                    std::swap(value, heap[parent]);
+                }
+            }
+            heap[index] = std::move(value);
+        }
+
+        /**
+         * Index of the element at the max end
+         * Precondition: the heap is not empty
+         */
+        std::size_t maxIndex() const {
+            if (heap.size() < 3) {
+                return heap.size() - 1;
+            }
+            return comp(heap[1], heap[2]) ? 2 : 1;
+        }
+
+        /**
+         * Remove the element at index (the root or the max child) and refill
+         * the hole with the last element
+         */
+        T removeAt(std::size_t index) {
+            T removed = std::move(heap[index]);
+            T last = std::move(heap.back());
+            heap.pop_back();
+            if (index < heap.size()) {
+                if (index == 0) {
+                    trickleDown<false>(0, std::move(last));
+                } else {
+                    trickleDown<true>(index, std::move(last));
+                }
+            }
+            return removed;
+        }
+
+        T emptyMin() const {
+            return heap_sift::emptyValue<T>(comp);
+        }
+
+        T emptyMax() const {
+            const Compare& order = comp;
+            return heap_sift::emptyValue<T>([&order](const T& a, const T& b) { return order(b, a); });
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty heap
+         * @param capacity: Number of elements to reserve room for
+         * @param compare: Ordering; comp(a, b) means a is nearer the min end
+         */
+        explicit MinMaxHeap(std::size_t capacity = 0, const Compare& compare = Compare())
+            : comp(compare) {
+            heap.reserve(capacity);
+        }
+
+        /**
+         * Constructor: Build a heap from a range in O(n), trickling every
+         * internal node down from the last parent back to the root
+         * @param first, last: Range of elements to load
+         * @param compare: Ordering; comp(a, b) means a is nearer the min end
+         */
+        template<typename InputIt,
+                 typename = typename std::iterator_traits<InputIt>::iterator_category>
+        MinMaxHeap(InputIt first, InputIt last, const Compare& compare = Compare())
+            : heap(first, last), comp(compare) {
+            for (std::size_t index = heap.size() / 2; index-- > 0;) {
+                if (onMaxLevel(index)) {
+                    trickleDown<true>(index, std::move(heap[index]));
+                } else {
+                    trickleDown<false>(index, std::move(heap[index]));
+                }
+            }
+        }
+
+        /**
+         * Add an element to the heap
+         * @param element: Value to be added
+         * @return: Always true; the heap grows on demand
+         */
+        bool add(const T& element) {
+            heap.push_back(element);  // push_back copes with element living in heap
+            bubbleUp(heap.size() - 1, std::move(heap.back()));
+            return true;
+        }
+
+        /**
+         * Add a copy of an element (same as add)
+         */
+        bool push(const T& element) {
+            return add(element);
+        }
+
+        /**
+         * Move an element into the heap
+         */
+        bool push(T&& element) {
+            return emplace(std::move(element));
+        }
+
+        /**
+         * Construct an element from args and insert it
+         * @param args: Constructor arguments for T
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args) {
+            heap.emplace_back(std::forward<Args>(args)...);
+            bubbleUp(heap.size() - 1, std::move(heap.back()));
+            return true;
+        }
+
+        /**
+         * Access the element at the min end in place
+         * Precondition: the heap is not empty
+         */
+        const T& top_min() const {
+            return heap[0];
+        }
+
+        /**
+         * Access the element at the max end in place
+         * Precondition: the heap is not empty
+         */
+        const T& top_max() const {
+            return heap[maxIndex()];
+        }
+
+        /**
+         * Peek at the minimum
+         * @return: The minimum, or the empty sentinel (the value that loses as a minimum) if empty
+         */
+        T peek_min() const {
+            return empty() ? emptyMin() : top_min();
+        }
+
+        /**
+         * Peek at the maximum
+         * @return: The maximum, or the empty sentinel (the value that loses as a maximum) if empty
+         */
+        T peek_max() const {
+            return empty() ? emptyMax() : top_max();
+        }
+
+        /**
+         * Remove and return the minimum
+         * @return: The removed element, or the empty sentinel if empty
+         */
+        T pop_min() {
+            return empty() ? emptyMin() : removeAt(0);
+        }
+
+        /**
+         * Remove and return the maximum
+         * @return: The removed element, or the empty sentinel if empty
+         */
+        T pop_max() {
+            return empty() ? emptyMax() : removeAt(maxIndex());
+        }
+
+        /**
+         * Peek at the minimum
+         * @return: The minimum, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_peek_min() const {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return top_min();
+        }
+
+        /**
+         * Peek at the maximum
+         * @return: The maximum, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_peek_max() const {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return top_max();
+        }
+
+        /**
+         * Remove and return the minimum
+         * @return: The removed element, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_pop_min() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeAt(0);
+        }
+
+        /**
+         * Remove and return the maximum
+         * @return: The removed element, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_pop_max() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeAt(maxIndex());
+        }
+
+        /**
+         * Get the current number of elements in the heap
+         */
+        std::size_t size() const {
+            return heap.size();
+        }
+
+        /**
+         * Check whether the heap holds no elements
+         */
+        bool empty() const {
+            return heap.empty();
+        }
+
+        /**
+         * Convert heap to string representation for display (level order)
+         * Requires T to support operator<<
+         */
+        std::string toString() const {
+            if (empty()) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            oss << '[';
+            for (std::size_t i = 0; i < heap.size(); ++i) {
+                oss << heap[i];
+                if (i + 1 < heap.size()) {
+                    oss << ',';
+                }
+            }
+            oss << ']';
+            return oss.str();
+        }
+};
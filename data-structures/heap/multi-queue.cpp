@@ -0,0 +1,62 @@
+/**
+ * MultiQueue Demonstration in C++
+ *
+ * A task scheduler that does not need strict priority order: four workers
+ * share a MultiQueue of task deadlines. Pops come out close to deadline
+ * order but not exactly in it; the demo shows how far off they are.
+ * (Lanes are picked at random, so the exact output varies between runs.)
+ */
+
+#include<atomic>
+#include<cstdlib>
+#include<iostream>
+#include<thread>
+#include<vector>
+#include "multi-queue.hpp"
+using namespace std;
+
+int main() {
+    const int workers = 4;
+    MultiQueue<int> tasks(workers, 2);
+    cout << "Lanes: " << tasks.laneCount() << endl;
+
+    for (int deadline = 0; deadline < 16; ++deadline) {
+        tasks.add((deadline * 5) % 16);
+    }
+    cout << "Queue: " << tasks.toString() << endl;
+    cout << "Pops:";
+    while (auto task = tasks.try_pop()) {
+        cout << " " << *task;
+    }
+    cout << endl;
+
+    // Workers drain 0..N-1 concurrently; the k-th pop overall would be k if
+    // the order were strict, so |task - k| shows how relaxed it is
+    const int count = 100000;
+    for (int deadline = count - 1; deadline >= 0; --deadline) {
+        tasks.add(deadline);
+    }
+    atomic<int> order{0};
+    vector<long long> displacement(workers, 0);
+    vector<thread> pool;
+    for (int w = 0; w < workers; ++w) {
+        pool.emplace_back([&tasks, &order, &displacement, w]() {
+            while (auto task = tasks.try_pop()) {
+                displacement[w] += llabs(*task - order.fetch_add(1));
+            }
+        });
+    }
+    for (thread& worker : pool) {
+        worker.join();
+    }
+
+    long long total = 0;
+    for (long long d : displacement) {
+        total += d;
+    }
+    cout << "Ran " << order.load() << " tasks on " << workers << " workers, average distance from deadline order: "
+         << static_cast<double>(total) / count << endl;
+    cout << "Queue: " << tasks.toString() << endl;
+
+    return 0;
+}
@@ -0,0 +1,272 @@
+/**
+ * MultiQueue Implementation in C++
+ *
+ * A relaxed concurrent priority queue (Rihani, Sanders and Dementiev, 2015):
+ * c x threads independent Heaps ("lanes"), each behind its own SpinLock.
+ * - add pushes into a random lane, trying another if the lock is taken; after
+ *   a few failed tries it waits on the last lane it picked (SpinLock::lock
+ *   yields), so oversubscribed threads stop burning their timeslice
+ * - pop try-locks two random lanes and pops the better of their tops
+ * With c x threads lanes two threads rarely pick the same one, so locks are
+ * almost never waited on and throughput grows with the thread count.
+ *
+ * The price is ordering: pop returns an element that is close to, but not
+ * necessarily, the overall top. Its rank error (how many better elements
+ * were present) is small on average, O(c x threads), and independent of
+ * the queue size. A larger c means less contention but a larger rank
+ * error; benchmarks/multiqueue-bench.cpp measures both for tuning.
+ *
+ * When the sampled lanes keep coming up empty, pop scans every lane once,
+ * so it only reports an empty queue when it found every lane empty.
+ *
+ * API follows Heap where it still makes sense: add/push/emplace, pop/try_pop,
+ * size, empty. There is no peek: a relaxed top would not predict what the
+ * next pop returns. size() is a snapshot, and toString() must only be
+ * called while no other thread uses the queue.
+ *
+ * Time Complexities:
+ * - add: O(log(n / lanes)) expected
+ * - pop: O(log(n / lanes)) expected
+ *
+ * Space Complexity: O(n + lanes)
+ */
+
+#pragma once
+
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<memory>
+#include<mutex>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<thread>
+#include<utility>
+#include "heap-sift.hpp"
+#include "heap.hpp"
+#include "spin-lock.hpp"
+
+template<typename T, typename Compare = std::less<T>>
+class MultiQueue {
+    private:
+        static constexpr unsigned sampleAttempts = 8;  // Random pairs tried before pop scans
+        static constexpr unsigned insertAttempts = 8;  // Random lanes tried before add blocks
+
+        struct alignas(64) Lane {  // One cache line per lock, no false sharing
+            SpinLock lock;
+            std::atomic<std::size_t> size{0};  // Copy of heap.size() readable without the lock
+            Heap<T, Compare> heap;
+        };
+
+        std::unique_ptr<Lane[]> lanes;
+        std::size_t numLanes;
+        Compare comp;
+
+        /**
+         * Per-thread xorshift64* generator, seeded from the thread id
+         */
+        static std::uint64_t nextRandom() {
+            thread_local std::uint64_t state =
+                std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 0x2545F4914F6CDD1Dull;
+        }
+
+        Lane& randomLane() {
+            return lanes[((nextRandom() >> 32) * numLanes) >> 32];
+        }
+
+        /**
+         * Push value into a random lane that is not locked, or after
+         * insertAttempts busy lanes, into the last one once it frees up
+         */
+        void insert(T value) {
+            Lane* lane = &randomLane();
+            for (unsigned attempt = 1; !lane->lock.try_lock(); ++attempt) {
+                if (attempt == insertAttempts) {
+                    lane->lock.lock();
+                    break;
+                }
+                cpuRelax();
+                lane = &randomLane();
+            }
+            lane->heap.push(std::move(value));
+            lane->size.store(lane->heap.size(), std::memory_order_relaxed);
+            lane->lock.unlock();
+        }
+
+        /**
+         * Pop the top of a locked lane
+         */
+        static std::optional<T> take(Lane& lane) {
+            std::optional<T> top = lane.heap.try_pop();
+            lane.size.store(lane.heap.size(), std::memory_order_relaxed);
+            return top;
+        }
+
+        /**
+         * Pop from the better of two random lanes
+         * @return: The element, or std::nullopt if the attempt found nothing to pop
+         */
+        std::optional<T> sample() {
+            Lane& a = randomLane();
+            Lane& b = randomLane();
+            if (a.size.load(std::memory_order_relaxed) == 0 &&
+                b.size.load(std::memory_order_relaxed) == 0) {
+                return std::nullopt;
+            }
+            if (!a.lock.try_lock()) {
+                return std::nullopt;
+            }
+            if (&b == &a) {
+                std::optional<T> top = take(a);
+                a.lock.unlock();
+                return top;
+            }
+            if (!b.lock.try_lock()) {
+                a.lock.unlock();
+                return std::nullopt;
+            }
+            bool useB = a.heap.empty() || (!b.heap.empty() && comp(b.heap.top(), a.heap.top()));
+            std::optional<T> top = take(useB ? b : a);
+            b.lock.unlock();
+            a.lock.unlock();
+            return top;
+        }
+
+        /**
+         * Pop from the first non-empty lane, visiting every lane once from a
+         * random start
+         */
+        std::optional<T> scan() {
+            const std::size_t start = ((nextRandom() >> 32) * numLanes) >> 32;
+            for (std::size_t k = 0; k < numLanes; ++k) {
+                Lane& lane = lanes[(start + k) % numLanes];
+                std::lock_guard<SpinLock> guard(lane.lock);
+                if (!lane.heap.empty()) {
+                    return take(lane);
+                }
+            }
+            return std::nullopt;
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty queue
+         * @param threads: Number of threads expected to use the queue
+         * @param c: Lanes per thread; more lanes, less contention, larger rank error
+         * @param compare: Ordering used to arrange the elements
+         */
+        explicit MultiQueue(std::size_t threads, std::size_t c = 2, const Compare& compare = Compare())
+            : numLanes(threads * c > 0 ? threads * c : 1), comp(compare) {
+            lanes.reset(new Lane[numLanes]);
+            for (std::size_t i = 0; i < numLanes; ++i) {
+                lanes[i].heap = Heap<T, Compare>(0, HeapCapacity::Growable, compare);
+            }
+        }
+
+        MultiQueue(const MultiQueue&) = delete;
+        MultiQueue& operator=(const MultiQueue&) = delete;
+
+        /**
+         * Add an element; safe to call from any thread
+         * @param element: Value to be added
+         * @return: Always true; the lanes grow on demand
+         */
+        bool add(const T& element) {
+            insert(element);
+            return true;
+        }
+
+        /**
+         * Add a copy of an element (same as add)
+         */
+        bool push(const T& element) {
+            return add(element);
+        }
+
+        /**
+         * Move an element into the queue
+         */
+        bool push(T&& element) {
+            insert(std::move(element));
+            return true;
+        }
+
+        /**
+         * Construct an element from args and insert it
+         * @param args: Constructor arguments for T
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args) {
+            insert(T(std::forward<Args>(args)...));
+            return true;
+        }
+
+        /**
+         * Remove and return an element near the top; safe to call from any thread
+         * @return: The element that was removed, or std::nullopt if every lane was empty
+         */
+        std::optional<T> try_pop() {
+            for (unsigned attempt = 0; attempt < sampleAttempts; ++attempt) {
+                if (std::optional<T> top = sample()) {
+                    return top;
+                }
+            }
+            return scan();
+        }
+
+        /**
+         * Remove and return an element near the top
+         * @return: The element that was removed, or the empty sentinel if every lane was empty
+         */
+        T pop() {
+            std::optional<T> top = try_pop();
+            return top ? std::move(*top) : heap_sift::emptyValue<T>(comp);
+        }
+
+        /**
+         * Get the number of elements (a snapshot while other threads run)
+         */
+        std::size_t size() const {
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < numLanes; ++i) {
+                total += lanes[i].size.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+        /**
+         * Check whether the queue holds no elements (a snapshot)
+         */
+        bool empty() const {
+            return size() == 0;
+        }
+
+        /**
+         * Number of independent heaps (c x threads)
+         */
+        std::size_t laneCount() const {
+            return numLanes;
+        }
+
+        /**
+         * Convert to string representation for display: each lane's heap
+         * Not thread-safe: call only while no other thread uses the queue
+         */
+        std::string toString() const {
+            if (empty()) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            for (std::size_t i = 0; i < numLanes; ++i) {
+                oss << (i == 0 ? "" : " ") << (lanes[i].heap.empty() ? "[]" : lanes[i].heap.toString());
+            }
+            return oss.str();
+        }
+};
@@ -0,0 +1,156 @@
+/**
+ * Node Pool for Pointer-Based Heaps
+ *
+ * Pointer-based heaps (pairing, leftist, Fibonacci, ...) allocate one node
+ * per element. Going through operator new for each of them costs a malloc
+ * call per push and scatters nodes across the address space. NodePool
+ * instead carves nodes out of large chunks and recycles freed nodes through
+ * an intrusive free list:
+ * - create(args...): pop a free slot (or take the next slot of the current
+ *   chunk) and construct a node in it, O(1)
+ * - destroy(node):   destruct the node and push its slot on the free list, O(1)
+ * - splice(other):   adopt all chunks and free slots of another pool, so
+ *   nodes created by other can be destroyed through this pool; used when
+ *   two heaps are melded
+ *
+ * Chunks are only returned to the system when the pool is destroyed. The
+ * pool does not track live nodes: its owner must destroy them (or, for
+ * trivially destructible nodes, simply drop them) before the pool goes away.
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<memory>
+#include<new>
+#include<utility>
+#include<vector>
+
+template<typename Node, std::size_t ChunkSize = 1024>
+class NodePool {
+    static_assert(ChunkSize > 0, "A chunk must hold at least one node");
+
+    private:
+        union Slot {
+            Slot* next;                                        // While on the free list
+            alignas(Node) unsigned char storage[sizeof(Node)]; // While holding a node
+        };
+
+        std::vector<std::unique_ptr<Slot[]>> chunks;
+        Slot* freeHead = nullptr;       // Recycled slots, most recent first
+        Slot* freeTail = nullptr;       // Last recycled slot, for O(1) splicing
+        std::size_t nextFresh = ChunkSize;  // Next untouched slot of chunks.back()
+
+        void pushFree(Slot* slot) {
+            slot->next = freeHead;
+            if (freeHead == nullptr) {
+                freeTail = slot;
+            }
+            freeHead = slot;
+        }
+
+        Slot* acquireSlot() {
+            if (freeHead != nullptr) {
+                Slot* slot = freeHead;
+                freeHead = slot->next;
+                if (freeHead == nullptr) {
+                    freeTail = nullptr;
+                }
+                return slot;
+            }
+            if (nextFresh == ChunkSize) {
+                chunks.emplace_back(new Slot[ChunkSize]);
+                nextFresh = 0;
+            }
+            return &chunks.back()[nextFresh++];
+        }
+
+    public:
+        NodePool() = default;
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        NodePool(NodePool&& other) noexcept
+            : chunks(std::move(other.chunks)), freeHead(other.freeHead),
+              freeTail(other.freeTail), nextFresh(other.nextFresh) {
+            other.chunks.clear();
+            other.freeHead = other.freeTail = nullptr;
+            other.nextFresh = ChunkSize;
+        }
+
+        NodePool& operator=(NodePool&& other) noexcept {
+            if (this != &other) {
+                chunks = std::move(other.chunks);
+                freeHead = other.freeHead;
+                freeTail = other.freeTail;
+                nextFresh = other.nextFresh;
+                other.chunks.clear();
+                other.freeHead = other.freeTail = nullptr;
+                other.nextFresh = ChunkSize;
+            }
+            return *this;
+        }
+
+        /**
+         * Construct a node in a pooled slot
+         * @param args: Constructor arguments for Node
+         * @return: Pointer to the new node
+         */
+        template<typename... Args>
+        Node* create(Args&&... args) {
+            Slot* slot = acquireSlot();
+            try {
+                return ::new (static_cast<void*>(slot->storage)) Node(std::forward<Args>(args)...);
+            } catch (...) {
+                pushFree(slot);
+                throw;
+            }
+        }
+
+        /**
+         * Destruct a node created by this pool (or a spliced one) and recycle its slot
+         */
+        void destroy(Node* node) noexcept {
+            node->~Node();
+            pushFree(reinterpret_cast<Slot*>(node));
+        }
+
+        /**
+         * Take over every chunk and free slot of other, leaving it empty
+         * Costs O(chunks of other) plus at most ChunkSize for its partly used chunk
+         */
+        void splice(NodePool& other) {
+            if (this == &other || other.chunks.empty()) {
+                return;
+            }
+            // Untouched slots of other's current chunk go on the free list
+            for (std::size_t i = other.nextFresh; i < ChunkSize; ++i) {
+                other.pushFree(&other.chunks.back()[i]);
+            }
+            if (other.freeHead != nullptr) {
+                other.freeTail->next = freeHead;
+                if (freeHead == nullptr) {
+                    freeTail = other.freeTail;
+                }
+                freeHead = other.freeHead;
+            }
+            // Keep our own current chunk last so its untouched slots stay usable
+            const std::size_t ownChunks = chunks.size();
+            for (auto& chunk : other.chunks) {
+                chunks.push_back(std::move(chunk));
+            }
+            if (ownChunks > 0) {
+                std::swap(chunks[ownChunks - 1], chunks.back());
+            }
+            other.chunks.clear();
+            other.freeHead = other.freeTail = nullptr;
+            other.nextFresh = ChunkSize;
+        }
+
+        /**
+         * Bytes currently reserved from the system
+         */
+        std::size_t reservedBytes() const {
+            return chunks.size() * ChunkSize * sizeof(Slot);
+        }
+};
@@ -0,0 +1,49 @@
+/**
+ * PairingHeap Demonstration in C++
+ *
+ * Shows the operations that make the pairing heap cheap for decrease-key
+ * heavy workloads: O(1) push, O(1) meld of two heaps, and decrease_key
+ * through the handle returned by push.
+ */
+
+#include<iostream>
+#include<vector>
+#include "pairing-heap.hpp"
+using namespace std;
+
+int main() {
+    PairingHeap<int> heap;
+    vector<PairingHeap<int>::Handle> handles;
+
+    // Step 1: Insert elements and keep their handles
+    for (int value : {42, 17, 8, 23, 15}) {
+        handles.push_back(heap.push(value));
+    }
+    cout << "After pushes: " << heap.toString() << ", top = " << heap.peek() << endl;
+
+    // Step 2: Meld in a second heap; its elements move over in O(1)
+    PairingHeap<int> other;
+    for (int value : {30, 5, 12}) {
+        other.push(value);
+    }
+    heap.meld(other);
+    cout << "After meld: " << heap.toString() << ", size = " << heap.size()
+         << ", other empty = " << other.empty() << endl;
+
+    // Step 3: Lower 23 to 1; it becomes the new top without any sifting
+    heap.decrease_key(handles[3], 1);
+    cout << "After decrease_key(23 -> 1): top = " << heap.peek() << endl;
+
+    // Step 4: Remove 17 wherever it sits
+    cout << "Erased " << heap.erase(handles[1]) << endl;
+
+    // Step 5: Drain in priority order
+    cout << "Popped:";
+    while (auto value = heap.try_pop()) {
+        cout << " " << *value;
+    }
+    cout << endl;
+    cout << "Pop on empty heap returns " << heap.pop() << endl;
+
+    return 0;
+}
@@ -0,0 +1,433 @@
+/**
+ * Pairing Heap Implementation in C++
+ *
+ * A heap-ordered multiway tree stored as child/sibling links. Every
+ * operation is built from one primitive, link(a, b), which makes the loser
+ * of the two roots the leftmost child of the winner:
+ * - push:          link the new node with the root
+ * - meld:          link the two roots
+ * - decrease_key:  cut the node's subtree out and link it with the root
+ * - pop:           remove the root and merge its children in two passes
+ *                  (pair them up left to right, then fold right to left)
+ *
+ * Compared with the array-backed Heap, push, meld and decrease_key do no
+ * sifting at all, which is what decrease-key heavy workloads such as
+ * Dijkstra on road graphs spend their time on. Nodes come from a NodePool,
+ * so a push costs no malloc call once the pool has warmed up.
+ *
+ * Each node keeps a `prev` link: its parent if it is the leftmost child,
+ * otherwise its left sibling. That is what lets decrease_key and erase cut
+ * a node out in O(1).
+ *
+ * Time Complexities:
+ * - push / meld / top / peek: O(1)
+ * - decrease_key: o(log n) amortized (O(1) in practice)
+ * - pop / erase / update: O(log n) amortized
+ *
+ * Space Complexity: O(n), three pointers per element
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<functional>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<utility>
+#include<vector>
+#include "heap-sift.hpp"
+#include "node-pool.hpp"
+
+template<typename T, typename Compare = std::less<T>>
+class PairingHeap {
+    private:
+        struct Node {
+            T value;
+            Node* child = nullptr;    // Leftmost child
+            Node* sibling = nullptr;  // Next sibling to the right
+            Node* prev = nullptr;     // Parent if leftmost child, else left sibling
+
+            template<typename... Args>
+            explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {}
+        };
+
+    public:
+        /**
+         * Stable reference to an element, valid until it is popped or erased
+         */
+        using Handle = Node*;
+
+    private:
+        NodePool<Node> pool;
+        Node* root = nullptr;
+        std::size_t count = 0;
+        Compare comp;
+
+        /**
+         * Link two roots: the loser becomes the leftmost child of the winner
+         * Ties keep a on top, so equal keys pop in insertion order after a meld
+         */
+        Node* link(Node* a, Node* b) {
+            if (a == nullptr) {
+                return b;
+            }
+            if (b == nullptr) {
+                return a;
+            }
+            if (comp(b->value, a->value)) {
+                std::swap(a, b);
+            }
+            b->prev = a;
+            b->sibling = a->child;
+            if (a->child != nullptr) {
+                a->child->prev = b;
+            }
+            a->child = b;
+            a->sibling = nullptr;
+            a->prev = nullptr;
+            return a;
+        }
+
+        /**
+         * Two-pass merge of a sibling list into a single tree
+         */
+        Node* mergePairs(Node* first) {
+            if (first == nullptr) {
+                return nullptr;
+            }
+
+            // Pass 1: link neighbours left to right, stacking the results
+            Node* pairs = nullptr;
+            while (first != nullptr) {
+                Node* a = first;
+                Node* b = a->sibling;
+                first = b != nullptr ? b->sibling : nullptr;
+                Node* merged = link(a, b);
+                merged->sibling = pairs;
+                pairs = merged;
+            }
+
+            // Pass 2: fold the stack, i.e. the pairs from right to left
+            Node* result = pairs;
+            pairs = pairs->sibling;
+            result->sibling = nullptr;
+            while (pairs != nullptr) {
+                Node* next = pairs->sibling;
+                result = link(result, pairs);
+                pairs = next;
+            }
+            result->prev = nullptr;
+            return result;
+        }
+
+        /**
+         * Detach a non-root node, with its subtree, from its parent and siblings
+         */
+        void cut(Node* node) {
+            if (node->prev->child == node) {
+                node->prev->child = node->sibling;
+            } else {
+                node->prev->sibling = node->sibling;
+            }
+            if (node->sibling != nullptr) {
+                node->sibling->prev = node->prev;
+            }
+            node->sibling = nullptr;
+            node->prev = nullptr;
+        }
+
+        /**
+         * Unlink a node from the tree, merging its children back in
+         */
+        void detach(Node* node) {
+            if (node == root) {
+                root = mergePairs(node->child);
+            } else {
+                cut(node);
+                root = link(root, mergePairs(node->child));
+            }
+            node->child = nullptr;
+        }
+
+        template<typename... Args>
+        Handle insert(Args&&... args) {
+            Node* node = pool.create(std::forward<Args>(args)...);
+            root = link(root, node);
+            count++;
+            return node;
+        }
+
+        /**
+         * Remove a node from the tree and return its value
+         */
+        T removeNode(Node* node) {
+            detach(node);
+            T value = std::move(node->value);
+            pool.destroy(node);
+            count--;
+            return value;
+        }
+
+        /**
+         * Destroy every node, visiting the child/sibling links as a binary
+         * tree and rotating it into a list, so no recursion or stack is needed
+         */
+        void clear() {
+            Node* node = root;
+            while (node != nullptr) {
+                if (node->child != nullptr) {
+                    Node* child = node->child;
+                    node->child = child->sibling;
+                    child->sibling = node;
+                    node = child;
+                } else {
+                    Node* next = node->sibling;
+                    pool.destroy(node);
+                    node = next;
+                }
+            }
+            root = nullptr;
+            count = 0;
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty heap
+         * @param capacity: Accepted for API parity with Heap; nodes are pooled on demand
+         * @param compare: Ordering used to arrange the elements
+         */
+        explicit PairingHeap(std::size_t capacity = 0, const Compare& compare = Compare())
+            : comp(compare) {
+            (void)capacity;
+        }
+
+        PairingHeap(const PairingHeap&) = delete;
+        PairingHeap& operator=(const PairingHeap&) = delete;
+
+        PairingHeap(PairingHeap&& other) noexcept
+            : pool(std::move(other.pool)), root(other.root), count(other.count),
+              comp(std::move(other.comp)) {
+            other.root = nullptr;
+            other.count = 0;
+        }
+
+        PairingHeap& operator=(PairingHeap&& other) noexcept {
+            if (this != &other) {
+                clear();
+                pool = std::move(other.pool);
+                root = other.root;
+                count = other.count;
+                comp = std::move(other.comp);
+                other.root = nullptr;
+                other.count = 0;
+            }
+            return *this;
+        }
+
+        ~PairingHeap() {
+            clear();
+        }
+
+        /**
+         * Insert an element
+         * @param element: Value to be added to the heap
+         * @return: Always true; a pairing heap is never full
+         */
+        bool add(const T& element) {
+            insert(element);
+            return true;
+        }
+
+        /**
+         * Insert an element by copy
+         * @return: Handle identifying the element until it is popped or erased
+         */
+        Handle push(const T& element) {
+            return insert(element);
+        }
+
+        /**
+         * Insert an element by move
+         * @return: Handle identifying the element until it is popped or erased
+         */
+        Handle push(T&& element) {
+            return insert(std::move(element));
+        }
+
+        /**
+         * Construct an element in place and insert it
+         * @param args: Constructor arguments for T
+         * @return: Handle identifying the element until it is popped or erased
+         */
+        template<typename... Args>
+        Handle emplace(Args&&... args) {
+            return insert(std::forward<Args>(args)...);
+        }
+
+        /**
+         * Move every element of other into this heap in O(1) (plus adopting
+         * other's node chunks); handles from other stay valid and now refer
+         * to elements of this heap. other is left empty.
+         */
+        void meld(PairingHeap& other) {
+            if (this == &other) {
+                return;
+            }
+            pool.splice(other.pool);
+            root = link(root, other.root);
+            count += other.count;
+            other.root = nullptr;
+            other.count = 0;
+        }
+
+        /**
+         * Change the key of an element to one that does not lose against the
+         * current key, moving it towards the top
+         * @param handle: Live handle returned by push
+         * @param key: New value
+         */
+        void decrease_key(Handle handle, T key) {
+            handle->value = std::move(key);
+            if (handle != root) {
+                cut(handle);
+                root = link(root, handle);
+            }
+        }
+
+        /**
+         * Change the key of an element in either direction
+         * @param handle: Live handle returned by push
+         * @param key: New value
+         */
+        void update(Handle handle, T key) {
+            if (!comp(handle->value, key)) {
+                decrease_key(handle, std::move(key));
+                return;
+            }
+            // The key got worse: its children may now beat it, so re-insert the node
+            detach(handle);
+            handle->value = std::move(key);
+            root = link(root, handle);
+        }
+
+        /**
+         * Remove an element wherever it sits in the heap
+         * @param handle: Live handle returned by push
+         * @return: The removed value
+         */
+        T erase(Handle handle) {
+            return removeNode(handle);
+        }
+
+        /**
+         * Value of the element behind a live handle
+         */
+        const T& value(Handle handle) const {
+            return handle->value;
+        }
+
+        /**
+         * Access the top element in place
+         * Precondition: the heap is not empty
+         */
+        const T& top() const {
+            return root->value;
+        }
+
+        /**
+         * Handle of the top element
+         * Precondition: the heap is not empty
+         */
+        Handle top_handle() const {
+            return root;
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The top element, or the empty sentinel if empty
+         */
+        T peek() const {
+            if (empty()) {
+                return heap_sift::emptyValue<T>(comp);
+            }
+            return top();
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The top element, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_peek() const {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return top();
+        }
+
+        /**
+         * Remove and return the top element
+         * @return: The element that was removed, or the empty sentinel if empty
+         */
+        T pop() {
+            if (empty()) {
+                return heap_sift::emptyValue<T>(comp);
+            }
+            return removeNode(root);
+        }
+
+        /**
+         * Remove and return the top element
+         * @return: The element that was removed, or std::nullopt if the heap is empty
+         */
+        std::optional<T> try_pop() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeNode(root);
+        }
+
+        /**
+         * Get the current number of elements in the heap
+         */
+        std::size_t size() const {
+            return count;
+        }
+
+        /**
+         * Check whether the heap holds no elements
+         */
+        bool empty() const {
+            return count == 0;
+        }
+
+        /**
+         * Convert heap to string representation for display (preorder:
+         * every node is followed by its subtree, the root comes first)
+         * Requires T to support operator<<
+         */
+        std::string toString() const {
+            if (empty()) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            oss << '[';
+            std::vector<const Node*> pending = {root};
+            bool first = true;
+            while (!pending.empty()) {
+                const Node* node = pending.back();
+                pending.pop_back();
+                oss << (first ? "" : ",") << node->value;
+                first = false;
+                if (node->sibling != nullptr) {
+                    pending.push_back(node->sibling);
+                }
+                if (node->child != nullptr) {
+                    pending.push_back(node->child);
+                }
+            }
+            oss << ']';
+            return oss.str();
+        }
+};
@@ -0,0 +1,39 @@
+/**
+ * RadixHeap Demonstration in C++
+ *
+ * A tiny discrete-event simulation: events are (time, id) pairs, and firing
+ * an event may schedule follow-up events later in time. Because no event is
+ * ever scheduled in the past, the monotone radix heap applies.
+ */
+
+#include<iostream>
+#include<string>
+#include<vector>
+#include "radix-heap.hpp"
+using namespace std;
+
+int main() {
+    vector<string> names = {"arrival", "service", "departure"};
+    RadixHeap<uint32_t, int> events;
+
+    // Step 1: Schedule three arrivals
+    for (uint32_t time : {5u, 1u, 12u}) {
+        events.add(time, 0);
+    }
+    cout << "Pending event times: " << events.toString() << endl;
+
+    // Step 2: Run the simulation; each arrival starts a service, each service ends in a departure
+    while (auto event = events.try_pop()) {
+        auto [time, kind] = *event;
+        cout << "t=" << time << " " << names[kind] << endl;
+        if (kind < 2) {
+            events.add(time + 3, kind + 1);
+        }
+    }
+
+    // Step 3: Scheduling in the past is rejected
+    bool accepted = events.add(2, 0);
+    cout << "Scheduling at t=2 after t=" << events.lastKey() << " accepted: " << (accepted ? "yes" : "no") << endl;
+
+    return 0;
+}
@@ -0,0 +1,268 @@
+/**
+ * Radix Heap Implementation in C++
+ *
+ * A monotone priority queue for unsigned integer keys: every key added must
+ * be at least the last key popped. That holds for Dijkstra (d(u) + w >= d(u))
+ * and for discrete-event simulation (events never fire in the past), and it
+ * lets the heap avoid comparisons between elements almost entirely.
+ *
+ * Elements live in bits(Key)+1 buckets. An element with key k sits in bucket
+ * bit_width(k XOR last), where last is the last key popped: bucket 0 holds
+ * keys equal to last, bucket i keys that first differ from last in bit i-1.
+ * pop takes from bucket 0; when it is empty, the first non-empty bucket is
+ * emptied into lower buckets relative to its minimum, which becomes the new
+ * last. An element only ever moves to a lower bucket, so it moves at most
+ * bits(Key) times over its lifetime, and each move is a sequential append.
+ *
+ * Each bucket remembers the index of its smallest element (buckets above 0
+ * only grow until they are emptied as a whole, so the index stays valid),
+ * and a bit mask records the non-empty buckets, so peek is O(1).
+ *
+ * Value: optional payload; RadixHeap<Key> stores bare keys, RadixHeap<Key,
+ * Value> stores std::pair<Key, Value> elements (e.g. (distance, vertex)).
+ *
+ * Time Complexities:
+ * - add: O(1)
+ * - pop: O(log C) amortized, C = largest key
+ * - peek / top: O(1)
+ *
+ * Space Complexity: O(n + log C)
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<limits>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<type_traits>
+#include<utility>
+#include<vector>
+#include "heap-sift.hpp"
+
+template<typename Key = std::uint64_t, typename Value = void>
+class RadixHeap {
+    static_assert(std::is_integral_v<Key> && std::is_unsigned_v<Key>,
+                  "Radix heap keys must be unsigned integers");
+    static_assert(std::numeric_limits<Key>::digits <= 64, "Keys wider than 64 bits are not supported");
+
+    public:
+        using Element = std::conditional_t<std::is_void_v<Value>, Key, std::pair<Key, Value>>;
+
+    private:
+        static constexpr unsigned bucketCount = std::numeric_limits<Key>::digits + 1;
+
+        std::vector<Element> buckets[bucketCount];
+        std::size_t minIndex[bucketCount] = {};  // Smallest element of each bucket above 0
+        std::uint64_t nonEmpty = 0;               // Bit i-1 set when bucket i > 0 is non-empty
+        Key last = 0;                             // Last key popped
+        std::size_t count = 0;
+
+        static Key keyOf(const Element& element) {
+            if constexpr (std::is_void_v<Value>) {
+                return element;
+            } else {
+                return element.first;
+            }
+        }
+
+        /**
+         * Bucket of key relative to last: the position of the highest differing bit
+         */
+        static unsigned bucketOf(Key key, Key last) {
+            unsigned long long diff = static_cast<unsigned long long>(key ^ last);
+            return diff == 0 ? 0 : 64 - static_cast<unsigned>(__builtin_clzll(diff));
+        }
+
+        void place(Element&& element) {
+            const unsigned b = bucketOf(keyOf(element), last);
+            std::vector<Element>& bucket = buckets[b];
+            if (b > 0) {
+                if (bucket.empty()) {
+                    nonEmpty |= std::uint64_t(1) << (b - 1);
+                    minIndex[b] = 0;
+                } else if (keyOf(element) < keyOf(bucket[minIndex[b]])) {
+                    minIndex[b] = bucket.size();
+                }
+            }
+            bucket.push_back(std::move(element));
+        }
+
+        /**
+         * Bucket holding the smallest element
+         * Precondition: the heap is not empty
+         */
+        unsigned firstBucket() const {
+            return buckets[0].empty() ? 1 + static_cast<unsigned>(__builtin_ctzll(nonEmpty)) : 0;
+        }
+
+        /**
+         * Make bucket 0 non-empty by redistributing the first non-empty bucket
+         * around its minimum
+         * Precondition: the heap is not empty
+         */
+        void refill() {
+            if (!buckets[0].empty()) {
+                return;
+            }
+            const unsigned b = firstBucket();
+            std::vector<Element> moving;
+            moving.swap(buckets[b]);
+            nonEmpty &= ~(std::uint64_t(1) << (b - 1));
+            last = keyOf(moving[minIndex[b]]);
+            for (Element& element : moving) {
+                place(std::move(element));  // Lands in a bucket below b
+            }
+            moving.clear();
+            buckets[b].swap(moving);  // Keep the bucket's allocation for reuse
+        }
+
+        Element removeTop() {
+            refill();
+            Element element = std::move(buckets[0].back());
+            buckets[0].pop_back();
+            count--;
+            return element;
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty heap
+         * @param capacity: Number of elements to reserve room for in the lowest bucket
+         */
+        explicit RadixHeap(std::size_t capacity = 0) {
+            buckets[0].reserve(capacity);
+        }
+
+        /**
+         * Insert an element
+         * @param element: Key, or (key, value) pair; its key must be >= lastKey()
+         * @return: false (and nothing is inserted) if the key is below lastKey()
+         */
+        bool push(Element element) {
+            if (keyOf(element) < last) {
+                return false;
+            }
+            place(std::move(element));
+            count++;
+            return true;
+        }
+
+        /**
+         * Insert a key (for heaps without a payload)
+         * @return: false if the key is below lastKey()
+         */
+        template<typename V = Value, typename = std::enable_if_t<std::is_void_v<V>>>
+        bool add(Key key) {
+            return push(key);
+        }
+
+        /**
+         * Insert a key with its payload
+         * @return: false if the key is below lastKey()
+         */
+        template<typename V = Value, typename = std::enable_if_t<!std::is_void_v<V>>>
+        bool add(Key key, V value) {
+            return push(Element(key, std::move(value)));
+        }
+
+        /**
+         * Access the smallest element in place
+         * Precondition: the heap is not empty
+         */
+        const Element& top() const {
+            const unsigned b = firstBucket();
+            return b == 0 ? buckets[0].back() : buckets[b][minIndex[b]];
+        }
+
+        /**
+         * Peek at the smallest element without removing it
+         * @return: The smallest element, or the empty sentinel if empty
+         */
+        Element peek() const {
+            if (empty()) {
+                return heap_sift::emptyValue<Element>(std::less<Element>());
+            }
+            return top();
+        }
+
+        /**
+         * Peek at the smallest element without removing it
+         * @return: The smallest element, or std::nullopt if the heap is empty
+         */
+        std::optional<Element> try_peek() const {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return top();
+        }
+
+        /**
+         * Remove and return the smallest element
+         * @return: The element that was removed, or the empty sentinel if empty
+         */
+        Element pop() {
+            if (empty()) {
+                return heap_sift::emptyValue<Element>(std::less<Element>());
+            }
+            return removeTop();
+        }
+
+        /**
+         * Remove and return the smallest element
+         * @return: The element that was removed, or std::nullopt if the heap is empty
+         */
+        std::optional<Element> try_pop() {
+            if (empty()) {
+                return std::nullopt;
+            }
+            return removeTop();
+        }
+
+        /**
+         * Lower bound for keys that may still be added: the key of the last
+         * element redistributed or popped (0 initially)
+         */
+        Key lastKey() const {
+            return last;
+        }
+
+        /**
+         * Get the current number of elements in the heap
+         */
+        std::size_t size() const {
+            return count;
+        }
+
+        /**
+         * Check whether the heap holds no elements
+         */
+        bool empty() const {
+            return count == 0;
+        }
+
+        /**
+         * Convert heap to string representation for display: the keys,
+         * bucket by bucket from the lowest (NOT sorted order)
+         */
+        std::string toString() const {
+            if (empty()) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            oss << '[';
+            bool first = true;
+            for (const std::vector<Element>& bucket : buckets) {
+                for (const Element& element : bucket) {
+                    oss << (first ? "" : ",") << +keyOf(element);
+                    first = false;
+                }
+            }
+            oss << ']';
+            return oss.str();
+        }
+};
@@ -0,0 +1,446 @@
+/**
+ * SIMD Child Selection for Arithmetic Heaps
+ *
+ * In a 4-, 8- or 16-ary heap the children of a node are contiguous, so picking
+ * the winning child is a horizontal min (or max) followed by a compare that
+ * turns "equals the min" into a bit mask; the lowest set bit is the answer:
+ * - SSE4.1:  pminsd/pminud, minps, minpd on 128-bit vectors
+ * - AVX2:    the same on 256-bit vectors; 64-bit integers have no min/max
+ *            instruction yet, so they compare with vpcmpgtq and blend
+ * - AVX-512: 512-bit vectors with native 64-bit integer min/max and mask
+ *            compares
+ * - Scalar:  the plain comparison loop, used on every other target (and for
+ *            64-bit integers below AVX2)
+ *
+ * Keys: int, unsigned, long, unsigned long, long long, unsigned long long,
+ * float and double. Floating-point keys must not be NaN (std::less is no
+ * strict weak ordering then); the winning child of a group holding one is
+ * unspecified.
+ *
+ * The best level the CPU supports is detected once at runtime, so one binary
+ * runs on any x86-64 server. Ties resolve to the lowest index, exactly like
+ * the scalar loop, so heap contents do not depend on the level in use.
+ * Loads are unaligned; aligned heap storage only avoids line splits.
+ */
+
+#pragma once
+
+#include<cstddef>
+#include<cstdint>
+#include<type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HEAP_SIMD_X86 1
+#include<immintrin.h>
+#endif
+
+/**
+ * Instruction set used by the child selection kernels
+ */
+enum class SimdLevel { Scalar, SSE41, AVX2, AVX512 };
+
+/**
+ * Kernel returning the index (0..N-1) of the winning child among N keys
+ */
+template<typename Key>
+using ChildSelector = unsigned (*)(const Key* keys);
+
+namespace simd_detail {
+
+    /**
+     * Vector layout of a key type; None for types without kernels
+     */
+    enum class KeyKind { None, Int32, UInt32, Int64, UInt64, Float, Double };
+
+    template<typename Key>
+    constexpr KeyKind keyKind() {
+        if constexpr (std::is_same_v<Key, float>) {
+            return KeyKind::Float;
+        } else if constexpr (std::is_same_v<Key, double>) {
+            return KeyKind::Double;
+        } else if constexpr (std::is_same_v<Key, int> || std::is_same_v<Key, long> ||
+                             std::is_same_v<Key, long long>) {
+            return sizeof(Key) == 4 ? KeyKind::Int32 : (sizeof(Key) == 8 ? KeyKind::Int64 : KeyKind::None);
+        } else if constexpr (std::is_same_v<Key, unsigned> || std::is_same_v<Key, unsigned long> ||
+                             std::is_same_v<Key, unsigned long long>) {
+            return sizeof(Key) == 4 ? KeyKind::UInt32 : (sizeof(Key) == 8 ? KeyKind::UInt64 : KeyKind::None);
+        } else {
+            return KeyKind::None;
+        }
+    }
+
+    template<std::size_t N, bool Max, typename Key>
+    unsigned scalarSelect(const Key* keys) {
+        unsigned best = 0;
+        for (unsigned i = 1; i < N; ++i) {
+            if (Max ? keys[i] > keys[best] : keys[i] < keys[best]) {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Index of the lowest set bit of the equality mask; only a NaN key can
+     * leave it empty, and the scalar loop then keeps the index in range
+     */
+    template<std::size_t N, bool Max, typename Key>
+    inline unsigned firstMatch(unsigned mask, const Key* keys) {
+        if constexpr (std::is_floating_point_v<Key>) {
+            if (mask == 0) {
+                return scalarSelect<N, Max>(keys);
+            }
+        }
+        return static_cast<unsigned>(__builtin_ctz(mask));
+    }
+
+#ifdef HEAP_SIMD_X86
+    template<KeyKind Kind, bool Max>
+    __attribute__((target("sse4.1")))
+    inline __m128i pick128(__m128i a, __m128i b) {
+        if constexpr (Kind == KeyKind::Int32) {
+            return Max ? _mm_max_epi32(a, b) : _mm_min_epi32(a, b);
+        } else if constexpr (Kind == KeyKind::UInt32) {
+            return Max ? _mm_max_epu32(a, b) : _mm_min_epu32(a, b);
+        } else if constexpr (Kind == KeyKind::Float) {
+            __m128 x = _mm_castsi128_ps(a), y = _mm_castsi128_ps(b);
+            return _mm_castps_si128(Max ? _mm_max_ps(x, y) : _mm_min_ps(x, y));
+        } else {
+            static_assert(Kind == KeyKind::Double, "No SSE4.1 min/max for 64-bit integers");
+            __m128d x = _mm_castsi128_pd(a), y = _mm_castsi128_pd(b);
+            return _mm_castpd_si128(Max ? _mm_max_pd(x, y) : _mm_min_pd(x, y));
+        }
+    }
+
+    /**
+     * One bit per key, set where a and b hold equal keys
+     */
+    template<KeyKind Kind>
+    __attribute__((target("sse4.1")))
+    inline unsigned equal128(__m128i a, __m128i b) {
+        if constexpr (Kind == KeyKind::Float) {
+            return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))));
+        } else if constexpr (Kind == KeyKind::Double) {
+            return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b))));
+        } else {
+            return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+        }
+    }
+
+    template<std::size_t N, bool Max, typename Key>
+    __attribute__((target("sse4.1")))
+    unsigned sse41Select(const Key* keys) {
+        constexpr KeyKind Kind = keyKind<Key>();
+        constexpr std::size_t Lanes = 16 / sizeof(Key);
+        const __m128i* vectors = reinterpret_cast<const __m128i*>(keys);
+        __m128i best = _mm_loadu_si128(vectors);
+        for (std::size_t i = 1; i < N / Lanes; ++i) {
+            best = pick128<Kind, Max>(best, _mm_loadu_si128(vectors + i));
+        }
+        // Broadcast the winner to every lane
+        best = pick128<Kind, Max>(best, _mm_shuffle_epi32(best, _MM_SHUFFLE(1, 0, 3, 2)));
+        if constexpr (Lanes == 4) {
+            best = pick128<Kind, Max>(best, _mm_shuffle_epi32(best, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+
+        unsigned mask = 0;
+        for (std::size_t i = 0; i < N / Lanes; ++i) {
+            mask |= equal128<Kind>(_mm_loadu_si128(vectors + i), best) << (Lanes * i);
+        }
+        return firstMatch<N, Max>(mask, keys);
+    }
+
+    template<KeyKind Kind, bool Max>
+    __attribute__((target("avx2")))
+    inline __m256i pick256(__m256i a, __m256i b) {
+        if constexpr (Kind == KeyKind::Int32) {
+            return Max ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+        } else if constexpr (Kind == KeyKind::UInt32) {
+            return Max ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b);
+        } else if constexpr (Kind == KeyKind::Float) {
+            __m256 x = _mm256_castsi256_ps(a), y = _mm256_castsi256_ps(b);
+            return _mm256_castps_si256(Max ? _mm256_max_ps(x, y) : _mm256_min_ps(x, y));
+        } else if constexpr (Kind == KeyKind::Double) {
+            __m256d x = _mm256_castsi256_pd(a), y = _mm256_castsi256_pd(b);
+            return _mm256_castpd_si256(Max ? _mm256_max_pd(x, y) : _mm256_min_pd(x, y));
+        } else {
+            __m256i x = a, y = b;
+            if constexpr (Kind == KeyKind::UInt64) {  // Flip the sign bits: unsigned order as signed
+                const __m256i flip = _mm256_set1_epi64x(INT64_MIN);
+                x = _mm256_xor_si256(a, flip);
+                y = _mm256_xor_si256(b, flip);
+            }
+            __m256i greater = _mm256_cmpgt_epi64(x, y);
+            return Max ? _mm256_blendv_epi8(b, a, greater) : _mm256_blendv_epi8(a, b, greater);
+        }
+    }
+
+    template<KeyKind Kind>
+    __attribute__((target("avx2")))
+    inline unsigned equal256(__m256i a, __m256i b) {
+        if constexpr (Kind == KeyKind::Float) {
+            __m256 equal = _mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ);
+            return static_cast<unsigned>(_mm256_movemask_ps(equal));
+        } else if constexpr (Kind == KeyKind::Double) {
+            __m256d equal = _mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ);
+            return static_cast<unsigned>(_mm256_movemask_pd(equal));
+        } else if constexpr (Kind == KeyKind::Int64 || Kind == KeyKind::UInt64) {
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))));
+        } else {
+            return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+        }
+    }
+
+    template<std::size_t N, bool Max, typename Key>
+    __attribute__((target("avx2")))
+    unsigned avx2Select(const Key* keys) {
+        constexpr KeyKind Kind = keyKind<Key>();
+        constexpr std::size_t Lanes = 32 / sizeof(Key);
+        const __m256i* vectors = reinterpret_cast<const __m256i*>(keys);
+        __m256i best = _mm256_loadu_si256(vectors);
+        for (std::size_t i = 1; i < N / Lanes; ++i) {
+            best = pick256<Kind, Max>(best, _mm256_loadu_si256(vectors + i));
+        }
+        // Broadcast the winner to every lane: across halves, then within them
+        best = pick256<Kind, Max>(best, _mm256_permute2x128_si256(best, best, 0x01));
+        best = pick256<Kind, Max>(best, _mm256_shuffle_epi32(best, _MM_SHUFFLE(1, 0, 3, 2)));
+        if constexpr (Lanes == 8) {
+            best = pick256<Kind, Max>(best, _mm256_shuffle_epi32(best, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+
+        unsigned mask = 0;
+        for (std::size_t i = 0; i < N / Lanes; ++i) {
+            mask |= equal256<Kind>(_mm256_loadu_si256(vectors + i), best) << (Lanes * i);
+        }
+        return firstMatch<N, Max>(mask, keys);
+    }
+
+    /**
+     * The AVX-512 helpers use the all-lanes masked intrinsics: GCC's unmasked
+     * min/max/shuffle forms start from an undefined vector and trip
+     * -Wuninitialized in every program that includes this header
+     */
+    template<KeyKind Kind, bool Max>
+    __attribute__((target("avx512f")))
+    inline __m512i pick512(__m512i a, __m512i b) {
+        if constexpr (Kind == KeyKind::Int32) {
+            return Max ? _mm512_mask_max_epi32(a, 0xFFFF, a, b) : _mm512_mask_min_epi32(a, 0xFFFF, a, b);
+        } else if constexpr (Kind == KeyKind::UInt32) {
+            return Max ? _mm512_mask_max_epu32(a, 0xFFFF, a, b) : _mm512_mask_min_epu32(a, 0xFFFF, a, b);
+        } else if constexpr (Kind == KeyKind::Int64) {
+            return Max ? _mm512_mask_max_epi64(a, 0xFF, a, b) : _mm512_mask_min_epi64(a, 0xFF, a, b);
+        } else if constexpr (Kind == KeyKind::UInt64) {
+            return Max ? _mm512_mask_max_epu64(a, 0xFF, a, b) : _mm512_mask_min_epu64(a, 0xFF, a, b);
+        } else if constexpr (Kind == KeyKind::Float) {
+            __m512 x = _mm512_castsi512_ps(a), y = _mm512_castsi512_ps(b);
+            return _mm512_castps_si512(Max ? _mm512_mask_max_ps(x, 0xFFFF, x, y) : _mm512_mask_min_ps(x, 0xFFFF, x, y));
+        } else {
+            __m512d x = _mm512_castsi512_pd(a), y = _mm512_castsi512_pd(b);
+            return _mm512_castpd_si512(Max ? _mm512_mask_max_pd(x, 0xFF, x, y) : _mm512_mask_min_pd(x, 0xFF, x, y));
+        }
+    }
+
+    /**
+     * The winning key of a vector, broadcast to every lane: swap 256-bit
+     * halves, then 128-bit quarters, then keys within each quarter
+     */
+    template<KeyKind Kind, bool Max>
+    __attribute__((target("avx512f")))
+    inline __m512i broadcastBest512(__m512i v) {
+        v = pick512<Kind, Max>(v, _mm512_mask_shuffle_i64x2(v, 0xFF, v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+        v = pick512<Kind, Max>(v, _mm512_mask_shuffle_i64x2(v, 0xFF, v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+        v = pick512<Kind, Max>(v, _mm512_mask_shuffle_epi32(v, 0xFFFF, v, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(1, 0, 3, 2))));
+        if constexpr (Kind == KeyKind::Int32 || Kind == KeyKind::UInt32 || Kind == KeyKind::Float) {
+            v = pick512<Kind, Max>(v, _mm512_mask_shuffle_epi32(v, 0xFFFF, v, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(2, 3, 0, 1))));
+        }
+        return v;
+    }
+
+    template<KeyKind Kind>
+    __attribute__((target("avx512f")))
+    inline unsigned equal512(__m512i a, __m512i b) {
+        if constexpr (Kind == KeyKind::Float) {
+            return _mm512_cmp_ps_mask(_mm512_castsi512_ps(a), _mm512_castsi512_ps(b), _CMP_EQ_OQ);
+        } else if constexpr (Kind == KeyKind::Double) {
+            return _mm512_cmp_pd_mask(_mm512_castsi512_pd(a), _mm512_castsi512_pd(b), _CMP_EQ_OQ);
+        } else if constexpr (Kind == KeyKind::Int64 || Kind == KeyKind::UInt64) {
+            return _mm512_cmpeq_epi64_mask(a, b);
+        } else {
+            return _mm512_cmpeq_epi32_mask(a, b);
+        }
+    }
+
+    template<std::size_t N, bool Max, typename Key>
+    __attribute__((target("avx512f")))
+    unsigned avx512Select(const Key* keys) {
+        constexpr KeyKind Kind = keyKind<Key>();
+        constexpr std::size_t Lanes = 64 / sizeof(Key);
+        __m512i best = _mm512_loadu_si512(keys);
+        for (std::size_t i = 1; i < N / Lanes; ++i) {
+            best = pick512<Kind, Max>(best, _mm512_loadu_si512(keys + Lanes * i));
+        }
+        best = broadcastBest512<Kind, Max>(best);
+
+        unsigned mask = 0;
+        for (std::size_t i = 0; i < N / Lanes; ++i) {
+            mask |= equal512<Kind>(_mm512_loadu_si512(keys + Lanes * i), best) << (Lanes * i);
+        }
+        return firstMatch<N, Max>(mask, keys);
+    }
+#endif
+
+    /**
+     * Kernels for one key type at one SIMD level, indexed by
+     * [Max][0 = 4-ary, 1 = 8-ary, 2 = 16-ary]
+     */
+    template<typename Key>
+    struct ChildSelectKernels {
+        ChildSelector<Key> select[2][3];
+        SimdLevel level;
+    };
+
+    /**
+     * Best kernels for Key up to the given level. A vector must not be
+     * wider than a sibling group, so 32-bit keys skip AVX2 for 4-ary nodes
+     * and AVX-512 for 4- and 8-ary nodes; 64-bit keys start at AVX2.
+     */
+    template<typename Key>
+    ChildSelectKernels<Key> kernelsFor(SimdLevel level) {
+        ChildSelectKernels<Key> k = {{{scalarSelect<4, false, Key>, scalarSelect<8, false, Key>, scalarSelect<16, false, Key>},
+                                      {scalarSelect<4, true, Key>, scalarSelect<8, true, Key>, scalarSelect<16, true, Key>}},
+                                     SimdLevel::Scalar};
+#ifdef HEAP_SIMD_X86
+        constexpr KeyKind Kind = keyKind<Key>();
+        constexpr bool wide = sizeof(Key) == 8;
+        if constexpr (Kind != KeyKind::Int64 && Kind != KeyKind::UInt64) {
+            if (level >= SimdLevel::SSE41) {
+                k.select[0][0] = sse41Select<4, false, Key>;
+                k.select[0][1] = sse41Select<8, false, Key>;
+                k.select[0][2] = sse41Select<16, false, Key>;
+                k.select[1][0] = sse41Select<4, true, Key>;
+                k.select[1][1] = sse41Select<8, true, Key>;
+                k.select[1][2] = sse41Select<16, true, Key>;
+                k.level = SimdLevel::SSE41;
+            }
+        }
+        if (level >= SimdLevel::AVX2) {
+            if constexpr (wide) {
+                k.select[0][0] = avx2Select<4, false, Key>;
+                k.select[1][0] = avx2Select<4, true, Key>;
+            }
+            k.select[0][1] = avx2Select<8, false, Key>;
+            k.select[0][2] = avx2Select<16, false, Key>;
+            k.select[1][1] = avx2Select<8, true, Key>;
+            k.select[1][2] = avx2Select<16, true, Key>;
+            k.level = SimdLevel::AVX2;
+        }
+        if (level >= SimdLevel::AVX512) {
+            if constexpr (wide) {
+                k.select[0][1] = avx512Select<8, false, Key>;
+                k.select[1][1] = avx512Select<8, true, Key>;
+            }
+            k.select[0][2] = avx512Select<16, false, Key>;
+            k.select[1][2] = avx512Select<16, true, Key>;
+            k.level = SimdLevel::AVX512;
+        }
+#else
+        (void)level;
+#endif
+        return k;
+    }
+
+    /**
+     * Highest level the kernels may use: the detected one unless capped
+     */
+    inline SimdLevel& levelCap();
+
+    /**
+     * Kernels currently in use for Key
+     */
+    template<typename Key>
+    ChildSelectKernels<Key>& activeKernels() {
+        static ChildSelectKernels<Key> kernels = kernelsFor<Key>(levelCap());
+        return kernels;
+    }
+
+    template<typename... Keys>
+    void refreshKernels(SimdLevel level) {
+        ((activeKernels<Keys>() = kernelsFor<Keys>(level)), ...);
+    }
+
+}  // namespace simd_detail
+
+/**
+ * Whether heaps of Key can select children with SIMD kernels
+ */
+template<typename Key>
+inline constexpr bool simdSelectKey = simd_detail::keyKind<Key>() != simd_detail::KeyKind::None;
+
+/**
+ * Best SIMD level supported by the CPU running the program
+ */
+inline SimdLevel detectSimdLevel() {
+#ifdef HEAP_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return SimdLevel::SSE41;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+inline SimdLevel& simd_detail::levelCap() {
+    static SimdLevel cap = detectSimdLevel();
+    return cap;
+}
+
+/**
+ * SIMD level used by heaps of Key in this process (64-bit integers
+ * report Scalar below AVX2)
+ */
+template<typename Key = int>
+inline SimdLevel simdLevel() {
+    return simd_detail::activeKernels<Key>().level;
+}
+
+/**
+ * Restrict the kernels to at most the given level (e.g. Scalar to compare
+ * against the fallback). Levels the CPU lacks are never enabled.
+ * Not thread-safe: call it before heaps are used concurrently.
+ * @param level: Highest SIMD level to use
+ */
+inline void setSimdLevel(SimdLevel level) {
+    SimdLevel detected = detectSimdLevel();
+    simd_detail::levelCap() = level < detected ? level : detected;
+    simd_detail::refreshKernels<int, unsigned, long, unsigned long, long long, unsigned long long,
+                                float, double>(simd_detail::levelCap());
+}
+
+/**
+ * Human-readable name of a SIMD level
+ */
+inline const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SSE41: return "sse4.1";
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::AVX512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+/**
+ * Active kernel selecting the winning child among N contiguous keys
+ * N must be 4, 8 or 16; Max selects the largest key instead of the smallest
+ */
+template<std::size_t N, bool Max, typename Key = int>
+inline ChildSelector<Key> childSelector() {
+    static_assert(N == 4 || N == 8 || N == 16, "SIMD child selection supports 4, 8 or 16 children");
+    static_assert(simdSelectKey<Key>, "No SIMD child selection for this key type");
+    return simd_detail::activeKernels<Key>().select[Max ? 1 : 0][N == 4 ? 0 : (N == 8 ? 1 : 2)];
+}
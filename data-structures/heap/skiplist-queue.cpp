@@ -0,0 +1,63 @@
+/**
+ * SkipListQueue Demonstration in C++
+ *
+ * Basic operations from one thread, then producers and consumers running
+ * at the same time on one lock-free queue.
+ */
+
+#include<atomic>
+#include<iostream>
+#include<thread>
+#include<vector>
+#include "skiplist-queue.hpp"
+using namespace std;
+
+int main() {
+    SkipListQueue<int> queue;
+
+    for (int value : {42, 7, 19, 3, 25}) {
+        queue.add(value);
+    }
+    cout << "Queue: " << queue.toString() << endl;
+    cout << "Peek: " << queue.peek() << endl;
+    cout << "Pop: " << queue.pop() << ", then " << queue.pop() << endl;
+    cout << "Queue: " << queue.toString() << ", size " << queue.size() << endl;
+    while (queue.try_pop()) {
+    }
+
+    // Two producers add 0..9999 while two consumers pop concurrently
+    const int count = 10000;
+    atomic<int> produced{0};
+    atomic<long long> consumedSum{0};
+    atomic<int> consumed{0};
+    vector<thread> workers;
+    for (int p = 0; p < 2; ++p) {
+        workers.emplace_back([&queue, &produced, p]() {
+            for (int value = p; value < count; value += 2) {
+                queue.add(value);
+                produced++;
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        workers.emplace_back([&queue, &produced, &consumed, &consumedSum]() {
+            while (consumed.load() < count) {
+                if (auto value = queue.try_pop()) {
+                    consumedSum += *value;
+                    consumed++;
+                } else if (produced.load() == count && queue.empty()) {
+                    break;
+                }
+            }
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+
+    cout << "Consumed " << consumed.load() << " elements, sum " << consumedSum.load()
+         << " (expected " << static_cast<long long>(count) * (count - 1) / 2 << ")" << endl;
+    cout << "Queue: " << queue.toString() << endl;
+
+    return 0;
+}
@@ -0,0 +1,404 @@
+/**
+ * Lock-Free Skiplist Priority Queue in C++
+ *
+ * A linearizable concurrent priority queue with no locks at all (Lindén and
+ * Jonsson, 2013). An array heap funnels every pop through the root; here the
+ * elements live in a skiplist sorted by Compare, and pop claims the first
+ * element with a single atomic fetch-or, so threads contend on one word only
+ * briefly and never wait for each other.
+ * - pop deletes logically: it sets the low bit of the level-0 pointer to the
+ *   first live node, which marks that node as deleted. Deleted nodes form a
+ *   prefix of the list, and later pops walk past it
+ * - the prefix is unlinked in batches: only once a pop walked past more
+ *   than boundOffset deleted nodes does it swing the head's pointers past
+ *   them (one CAS per level) and retire them, so most pops write one word
+ * - add links a node bottom-up with one CAS per level, like a plain
+ *   lock-free skiplist; a node is live as soon as level 0 is linked
+ * - unlinked nodes are freed through EpochReclaimer, because other threads
+ *   may still be walking over them
+ *
+ * API follows Heap: add/push/emplace, peek/try_peek, pop/try_pop, empty.
+ * pop copies the element out (a concurrent peek may still be reading it),
+ * so T must be copyable. size() walks the list: O(n), and a snapshot while
+ * other threads run. toString() must only be called while no other thread
+ * uses the queue.
+ *
+ * Time Complexities:
+ * - add: O(log n) expected
+ * - pop: O(1) expected, plus the amortized batch unlinking
+ * - peek: O(1) expected (walks the deleted prefix)
+ *
+ * Space Complexity: O(n) expected, plus up to boundOffset deleted nodes
+ * and the retired nodes not yet freed
+ */
+
+#pragma once
+
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<new>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<thread>
+#include<utility>
+#include "epoch-reclaimer.hpp"
+#include "heap-sift.hpp"
+
+template<typename T, typename Compare = std::less<T>>
+class SkipListQueue {
+    private:
+        static constexpr unsigned maxLevels = 32;
+        static constexpr std::size_t boundOffset = 32;  // Deleted nodes walked past before unlinking
+        static constexpr std::uintptr_t deletedBit = 1;  // On a level-0 pointer: its target is deleted
+
+        struct Node {
+            T value;
+            std::atomic<bool> inserting{true};  // Upper levels are still being linked
+            unsigned height;
+            std::atomic<std::uintptr_t>* next;  // height tagged pointers, stored after the node
+
+            template<typename... Args>
+            Node(unsigned levels, Args&&... args)
+                : value(std::forward<Args>(args)...), height(levels) {}
+        };
+
+        Node* head;
+        Node* tail;
+        Compare comp;
+
+        static Node* pointer(std::uintptr_t tagged) {
+            return reinterpret_cast<Node*>(tagged & ~deletedBit);
+        }
+
+        static bool isDeleted(std::uintptr_t tagged) {
+            return (tagged & deletedBit) != 0;
+        }
+
+        static std::uintptr_t tag(Node* node, bool deleted = false) {
+            return reinterpret_cast<std::uintptr_t>(node) | (deleted ? deletedBit : 0);
+        }
+
+        template<typename... Args>
+        static Node* makeNode(unsigned height, Args&&... args) {
+            void* raw = ::operator new(sizeof(Node) + height * sizeof(std::atomic<std::uintptr_t>),
+                                       std::align_val_t(alignof(Node)));
+            Node* node = new (raw) Node(height, std::forward<Args>(args)...);
+            node->next = reinterpret_cast<std::atomic<std::uintptr_t>*>(static_cast<char*>(raw) + sizeof(Node));
+            for (unsigned level = 0; level < height; ++level) {
+                new (&node->next[level]) std::atomic<std::uintptr_t>(0);
+            }
+            return node;
+        }
+
+        static void destroyNode(void* raw) {
+            static_cast<Node*>(raw)->~Node();
+            ::operator delete(raw, std::align_val_t(alignof(Node)));
+        }
+
+        /**
+         * Geometric height: level k+1 with probability 1/2^k
+         */
+        static unsigned randomHeight() {
+            thread_local std::uint64_t state =
+                std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            std::uint64_t bits = (state * 0x2545F4914F6CDD1Dull) | (std::uint64_t(1) << (maxLevels - 1));
+            return 1 + static_cast<unsigned>(__builtin_ctzll(bits));
+        }
+
+        /**
+         * Whether node sorts before key (the tail sorts after everything)
+         */
+        bool before(const Node* node, const T& key) const {
+            return node != tail && comp(node->value, key);
+        }
+
+        /**
+         * Find, on every level, the last node before key and its successor,
+         * skipping deleted nodes
+         * @return: The last deleted node seen on level 0, or nullptr
+         */
+        Node* locatePreds(const T& key, Node** preds, Node** succs) const {
+            Node* deleted = nullptr;
+            Node* pred = head;
+            for (unsigned level = maxLevels; level-- > 0;) {
+                std::uintptr_t link = pred->next[level].load();
+                Node* cur = pointer(link);
+                bool curDeleted = isDeleted(link);
+                while (before(cur, key) || isDeleted(cur->next[0].load()) || (level == 0 && curDeleted)) {
+                    if (level == 0 && curDeleted) {
+                        deleted = cur;
+                    }
+                    pred = cur;
+                    link = pred->next[level].load();
+                    cur = pointer(link);
+                    curDeleted = isDeleted(link);
+                }
+                preds[level] = pred;
+                succs[level] = cur;
+            }
+            return deleted;
+        }
+
+        /**
+         * Link node on level 0 (where it becomes live), then on its upper
+         * levels from the bottom up, giving up on a level that would link it
+         * next to deleted nodes
+         */
+        void insert(Node* node) {
+            EpochReclaimer::Guard guard;
+            Node* preds[maxLevels];
+            Node* succs[maxLevels];
+            Node* deleted;
+            while (true) {
+                deleted = locatePreds(node->value, preds, succs);
+                node->next[0].store(tag(succs[0]), std::memory_order_relaxed);
+                std::uintptr_t expected = tag(succs[0]);
+                if (preds[0]->next[0].compare_exchange_strong(expected, tag(node))) {
+                    break;
+                }
+            }
+            for (unsigned level = 1; level < node->height;) {
+                node->next[level].store(tag(succs[level]));
+                if (isDeleted(node->next[0].load()) || isDeleted(succs[level]->next[0].load()) ||
+                    succs[level] == deleted) {
+                    break;  // node or its successor is already being deleted
+                }
+                std::uintptr_t expected = tag(succs[level]);
+                if (preds[level]->next[level].compare_exchange_strong(expected, tag(node))) {
+                    ++level;
+                } else {
+                    deleted = locatePreds(node->value, preds, succs);
+                    if (succs[0] != node) {
+                        break;
+                    }
+                }
+            }
+            node->inserting.store(false);
+        }
+
+        /**
+         * Swing the head's upper-level pointers past deleted nodes
+         */
+        void restructure() {
+            Node* pred = head;
+            for (unsigned level = maxLevels - 1; level > 0;) {
+                std::uintptr_t first = head->next[level].load();
+                if (!isDeleted(pointer(first)->next[0].load())) {
+                    --level;
+                    continue;
+                }
+                std::uintptr_t cur = pred->next[level].load();
+                while (isDeleted(pointer(cur)->next[0].load())) {
+                    pred = pointer(cur);
+                    cur = pred->next[level].load();
+                }
+                if (head->next[level].compare_exchange_strong(first, pred->next[level].load())) {
+                    --level;
+                }
+            }
+        }
+
+        std::optional<T> remove() {
+            EpochReclaimer::Guard guard;
+            Node* x = head;
+            Node* newHead = nullptr;
+            std::size_t offset = 0;
+            std::uintptr_t observedHead = head->next[0].load();
+            std::uintptr_t link;
+            do {
+                link = x->next[0].load();
+                if (pointer(link) == tail) {
+                    return std::nullopt;
+                }
+                if (newHead == nullptr && x->inserting.load()) {
+                    newHead = x;  // Keep nodes still being linked on upper levels
+                }
+                link = x->next[0].fetch_or(deletedBit);
+                ++offset;
+                x = pointer(link);
+            } while (isDeleted(link));
+
+            std::optional<T> result(x->value);
+            if (newHead == nullptr) {
+                newHead = x;
+            }
+            if (offset <= boundOffset || head->next[0].load() != observedHead) {
+                return result;
+            }
+            if (head->next[0].compare_exchange_strong(observedHead, tag(newHead, true))) {
+                restructure();
+                for (Node* cur = pointer(observedHead); cur != newHead;) {
+                    Node* next = pointer(cur->next[0].load());
+                    EpochReclaimer::retire(cur, destroyNode);
+                    cur = next;
+                }
+            }
+            return result;
+        }
+
+        std::optional<T> first() const {
+            EpochReclaimer::Guard guard;
+            std::uintptr_t link = head->next[0].load();
+            while (isDeleted(link)) {
+                link = pointer(link)->next[0].load();
+            }
+            Node* node = pointer(link);
+            if (node == tail) {
+                return std::nullopt;
+            }
+            return node->value;
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty queue
+         * @param compare: Ordering used to arrange the elements
+         */
+        explicit SkipListQueue(const Compare& compare = Compare())
+            : head(makeNode(maxLevels)), tail(makeNode(maxLevels)), comp(compare) {
+            head->inserting.store(false);
+            tail->inserting.store(false);
+            for (unsigned level = 0; level < maxLevels; ++level) {
+                head->next[level].store(tag(tail));
+            }
+        }
+
+        SkipListQueue(const SkipListQueue&) = delete;
+        SkipListQueue& operator=(const SkipListQueue&) = delete;
+
+        /**
+         * Destructor: frees every node still linked
+         * Must only run once no other thread uses the queue
+         */
+        ~SkipListQueue() {
+            Node* node = head;
+            while (node != tail) {
+                Node* next = pointer(node->next[0].load());
+                destroyNode(node);
+                node = next;
+            }
+            destroyNode(tail);
+        }
+
+        /**
+         * Add an element; safe to call from any thread
+         * @param element: Value to be added
+         * @return: Always true
+         */
+        bool add(const T& element) {
+            insert(makeNode(randomHeight(), element));
+            return true;
+        }
+
+        /**
+         * Add a copy of an element (same as add)
+         */
+        bool push(const T& element) {
+            return add(element);
+        }
+
+        /**
+         * Move an element into the queue
+         */
+        bool push(T&& element) {
+            insert(makeNode(randomHeight(), std::move(element)));
+            return true;
+        }
+
+        /**
+         * Construct an element in its node from args and insert it
+         * @param args: Constructor arguments for T
+         */
+        template<typename... Args>
+        bool emplace(Args&&... args) {
+            insert(makeNode(randomHeight(), std::forward<Args>(args)...));
+            return true;
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The current top, or the empty sentinel if empty
+         */
+        T peek() const {
+            std::optional<T> top = first();
+            return top ? std::move(*top) : heap_sift::emptyValue<T>(comp);
+        }
+
+        /**
+         * Peek at the top element without removing it
+         * @return: The current top, or std::nullopt if the queue is empty
+         */
+        std::optional<T> try_peek() const {
+            return first();
+        }
+
+        /**
+         * Remove and return the top element; safe to call from any thread
+         * @return: The element that was removed, or the empty sentinel if empty
+         */
+        T pop() {
+            std::optional<T> top = remove();
+            return top ? std::move(*top) : heap_sift::emptyValue<T>(comp);
+        }
+
+        /**
+         * Remove and return the top element; safe to call from any thread
+         * @return: The element that was removed, or std::nullopt if the queue is empty
+         */
+        std::optional<T> try_pop() {
+            return remove();
+        }
+
+        /**
+         * Count the live elements: O(n), a snapshot while other threads run
+         */
+        std::size_t size() const {
+            EpochReclaimer::Guard guard;
+            std::uintptr_t link = head->next[0].load();
+            while (isDeleted(link)) {
+                link = pointer(link)->next[0].load();
+            }
+            std::size_t count = 0;
+            for (Node* node = pointer(link); node != tail; node = pointer(node->next[0].load())) {
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+         * Check whether the queue holds no live elements (a snapshot)
+         */
+        bool empty() const {
+            return !first().has_value();
+        }
+
+        /**
+         * Convert to string representation for display: the live elements
+         * in sorted order
+         * Not thread-safe: call only while no other thread uses the queue
+         * Requires T to support operator<<
+         */
+        std::string toString() const {
+            std::uintptr_t link = head->next[0].load();
+            while (isDeleted(link)) {
+                link = pointer(link)->next[0].load();
+            }
+            if (pointer(link) == tail) {
+                return "No element!";
+            }
+
+            std::ostringstream oss;
+            oss << '[';
+            for (Node* node = pointer(link); node != tail; node = pointer(node->next[0].load())) {
+                oss << (node == pointer(link) ? "" : ",") << node->value;
+            }
+            oss << ']';
+            return oss.str();
+        }
+};
@@ -0,0 +1,69 @@
+/**
+ * Spin Lock
+ *
+ * A one-byte lock for the short critical sections of the concurrent heaps
+ * (one node, or a size counter): waiting threads spin on a plain load
+ * (test-and-test-and-set, so the line stays shared while the lock is held)
+ * with a pause hint, and yield their time slice after a few dozen rounds
+ * so that an oversubscribed machine still makes progress.
+ *
+ * Meets the Lockable requirements: works with std::lock_guard,
+ * std::unique_lock and std::try_to_lock.
+ */
+
+#pragma once
+
+#include<atomic>
+#include<thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include<immintrin.h>
+#endif
+
+/**
+ * Tell the CPU this is a spin-wait loop (PAUSE on x86, nothing elsewhere)
+ */
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#endif
+}
+
+class SpinLock {
+    private:
+        std::atomic<bool> locked{false};
+
+    public:
+        SpinLock() = default;
+        SpinLock(const SpinLock&) = delete;
+        SpinLock& operator=(const SpinLock&) = delete;
+
+        /**
+         * Acquire the lock, spinning (then yielding) while another thread holds it
+         */
+        void lock() {
+            unsigned spins = 0;
+            while (locked.exchange(true, std::memory_order_acquire)) {
+                while (locked.load(std::memory_order_relaxed)) {
+                    if (++spins < 64) {
+                        cpuRelax();
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+        /**
+         * Acquire the lock only if it is free
+         * @return: true if the lock is now held by the caller
+         */
+        bool try_lock() {
+            return !locked.load(std::memory_order_relaxed) &&
+                   !locked.exchange(true, std::memory_order_acquire);
+        }
+
+        void unlock() {
+            locked.store(false, std::memory_order_release);
+        }
+};
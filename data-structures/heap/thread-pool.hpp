@@ -0,0 +1,123 @@
+/**
+ * Thread Pool for Data-Parallel Loops
+ *
+ * A fixed set of worker threads that run one indexed loop at a time:
+ * run(count, task) calls task(i) for every i in [0, count), spread over the
+ * workers and the calling thread, and returns once all calls are done.
+ * Indices are handed out one at a time from an atomic counter, so uneven
+ * tasks balance themselves. Used by heap_sift::heapifyParallel.
+ *
+ * run must not be called concurrently from several threads or from inside
+ * a task.
+ */
+
+#pragma once
+
+#include<atomic>
+#include<condition_variable>
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<mutex>
+#include<thread>
+#include<vector>
+
+class ThreadPool {
+    private:
+        std::vector<std::thread> workers;
+        std::mutex lock;
+        std::condition_variable wake;      // Workers wait here for a loop
+        std::condition_variable finished;  // run waits here for the workers
+        std::function<void(std::size_t)> task;
+        std::size_t count = 0;
+        std::atomic<std::size_t> nextIndex{0};
+        std::size_t running = 0;           // Workers still inside the current loop
+        std::uint64_t generation = 0;      // Incremented for every loop
+        bool stopping = false;
+
+        void drain() {
+            for (std::size_t i = nextIndex.fetch_add(1); i < count; i = nextIndex.fetch_add(1)) {
+                task(i);
+            }
+        }
+
+        void work() {
+            std::uint64_t seen = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> guard(lock);
+                    wake.wait(guard, [this, seen]() { return stopping || generation != seen; });
+                    if (stopping) {
+                        return;
+                    }
+                    seen = generation;
+                }
+                drain();
+                std::lock_guard<std::mutex> guard(lock);
+                if (--running == 0) {
+                    finished.notify_one();
+                }
+            }
+        }
+
+    public:
+        /**
+         * Constructor: Start the workers
+         * @param threads: Threads taking part in each loop, the caller included
+         *                 (defaults to the number of hardware threads)
+         */
+        explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency()) {
+            for (std::size_t i = 1; i < threads; ++i) {
+                workers.emplace_back([this]() { work(); });
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+
+        /**
+         * Number of threads taking part in each loop, the caller included
+         */
+        std::size_t size() const {
+            return workers.size() + 1;
+        }
+
+        /**
+         * Call body(i) for every i in [0, n) on the pool and wait for all of them
+         * @param n: Number of iterations
+         * @param body: Callable taking the iteration index; must be safe to run concurrently
+         */
+        template<typename Body>
+        void run(std::size_t n, Body&& body) {
+            if (workers.empty() || n < 2) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    body(i);
+                }
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                task = std::ref(body);
+                count = n;
+                nextIndex.store(0);
+                running = workers.size();
+                ++generation;
+            }
+            wake.notify_all();
+            drain();
+            std::unique_lock<std::mutex> guard(lock);
+            finished.wait(guard, [this]() { return running == 0; });
+            task = nullptr;
+        }
+};
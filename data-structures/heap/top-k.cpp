@@ -0,0 +1,52 @@
+/**
+ * TopK Demonstration in C++
+ *
+ * Keeps the 5 highest scores of a stream, then splits a larger stream
+ * across threads, each with its own TopK, and merges the per-thread results.
+ */
+
+#include<functional>
+#include<iostream>
+#include<thread>
+#include<vector>
+#include "top-k.hpp"
+using namespace std;
+
+int main() {
+    TopK<int, 5> best;
+
+    vector<int> scores = {40, 75, 12, 88, 63, 91, 27, 70, 55, 99, 3};
+    for (int score : scores) {
+        bool kept = best.add(score);
+        cout << "Offered " << score << (kept ? ": kept  " : ": lost  ") << best.toString();
+        if (best.full()) {
+            cout << ", threshold " << best.threshold();
+        }
+        cout << endl;
+    }
+
+    // The 3 smallest of 0..9999 (scrambled), one TopK per thread
+    const int threads = 4;
+    const int count = 10000;
+    vector<TopK<int, 3, greater<int>>> partial(threads);
+    vector<thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&partial, t]() {
+            for (int i = t; i < count; i += threads) {
+                partial[t].add((i * 7919) % count);
+            }
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+
+    TopK<int, 3, greater<int>> smallest;
+    for (int t = 0; t < threads; ++t) {
+        cout << "Thread " << t << ": " << partial[t].toString() << endl;
+        smallest.merge(partial[t]);
+    }
+    cout << "Merged: " << smallest.toString() << endl;
+
+    return 0;
+}
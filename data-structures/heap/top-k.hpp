@@ -0,0 +1,234 @@
+/**
+ * Top-K Selection in C++
+ *
+ * Keeps the K largest elements of a stream (largest per Compare: with
+ * std::less the K biggest, with std::greater the K smallest). The kept
+ * elements sit in a heap of size K whose top is the weakest of them, the
+ * threshold a new element has to beat.
+ *
+ * The usual pattern on a plain MinHeap is "add, then pop once the size
+ * exceeds K", a full sift-up and sift-down for every element of the stream.
+ * TopK instead:
+ * - compares a new element against the threshold first; on a long stream
+ *   almost every element loses and never touches the heap
+ * - replaces the threshold in place (Heap::replace_top) when it wins: one
+ *   sift-down, no sift-up
+ *
+ * Per-thread results combine with merge, which feeds another TopK's
+ * elements through the same filter, so a parallel scan keeps one TopK per
+ * thread and merges them at the end.
+ *
+ * Time Complexities:
+ * - add: O(1) for an element that loses, O(log K) for one that wins
+ * - merge with another TopK: O(K log K)
+ * - threshold / peek: O(1)
+ * - sorted: O(K log K)
+ *
+ * Space Complexity: O(K)
+ */
+
+#pragma once
+
+#include<algorithm>
+#include<cstddef>
+#include<functional>
+#include<iterator>
+#include<optional>
+#include<sstream>
+#include<string>
+#include<utility>
+#include<vector>
+#include "heap.hpp"
+
+template<typename T, std::size_t K, typename Compare = std::less<T>>
+class TopK {
+    static_assert(K > 0, "TopK must keep at least one element");
+
+    private:
+        Heap<T, Compare> heap;  // The kept elements, weakest on top
+        Compare comp;
+
+        /**
+         * Whether element enters the kept set: there is room, or it beats
+         * the threshold (ties keep the element already there)
+         */
+        bool wins(const T& element) const {
+            return heap.size() < K || comp(heap.top(), element);
+        }
+
+    public:
+        /**
+         * Constructor: Initialize an empty selection
+         * @param compare: Ordering; the K elements that compare greatest are kept
+         */
+        explicit TopK(const Compare& compare = Compare())
+            : heap(K, HeapCapacity::Growable, compare), comp(compare) {}
+
+        /**
+         * Offer an element from the stream
+         * @param element: Candidate value
+         * @return: true if the element is now among the top K, false if it lost
+         */
+        bool add(const T& element) {
+            if (!wins(element)) {
+                return false;
+            }
+            if (heap.size() < K) {
+                heap.push(element);
+            } else {
+                heap.replace_top(element);
+            }
+            return true;
+        }
+
+        /**
+         * Offer an element (same as add)
+         */
+        bool push(const T& element) {
+            return add(element);
+        }
+
+        /**
+         * Offer an element, moving it in only if it wins
+         * @return: true if the element is now among the top K (element was moved from)
+         */
+        bool push(T&& element) {
+            if (!wins(element)) {
+                return false;
+            }
+            if (heap.size() < K) {
+                heap.push(std::move(element));
+            } else {
+                heap.replace_top(std::move(element));
+            }
+            return true;
+        }
+
+        /**
+         * Offer every element of a range
+         * @param first, last: Range of candidates
+         * @return: Number of candidates that entered the top K when offered
+         */
+        template<typename InputIt>
+        std::size_t add(InputIt first, InputIt last) {
+            std::size_t kept = 0;
+            for (; first != last; ++first) {
+                kept += add(*first) ? 1 : 0;
+            }
+            return kept;
+        }
+
+        /**
+         * Combine with the result of another selection (e.g. another thread's),
+         * keeping the top K of both
+         * @param other: Selection with the same ordering; left empty
+         */
+        void merge(TopK& other) {
+            if (this == &other) {
+                return;
+            }
+            while (!other.heap.empty()) {
+                push(other.heap.pop());
+            }
+        }
+
+        /**
+         * Combine with the result of a temporary selection
+         */
+        void merge(TopK&& other) {
+            merge(other);
+        }
+
+        /**
+         * Access the threshold in place: the weakest of the kept elements
+         * Precondition: the selection is not empty
+         */
+        const T& threshold() const {
+            return heap.top();
+        }
+
+        /**
+         * Peek at the threshold
+         * @return: The weakest kept element, or the empty sentinel if empty
+         */
+        T peek() const {
+            return heap.peek();
+        }
+
+        /**
+         * Peek at the threshold
+         * @return: The weakest kept element, or std::nullopt if empty
+         */
+        std::optional<T> try_peek() const {
+            return heap.try_peek();
+        }
+
+        /**
+         * The kept elements, best first
+         */
+        std::vector<T> sorted() const {
+            Heap<T, Compare> copy = heap;
+            std::vector<T> result;
+            result.reserve(copy.size());
+            copy.pop_n(copy.size(), std::back_inserter(result));
+            std::reverse(result.begin(), result.end());
+            return result;
+        }
+
+        /**
+         * Forget every kept element
+         */
+        void clear() {
+            heap = Heap<T, Compare>(K, HeapCapacity::Growable, comp);
+        }
+
+        /**
+         * Number of elements kept (K once the stream held K elements)
+         */
+        std::size_t size() const {
+            return heap.size();
+        }
+
+        /**
+         * Check whether no element has been kept yet
+         */
+        bool empty() const {
+            return heap.empty();
+        }
+
+        /**
+         * Check whether K elements are kept, so new ones must beat the threshold
+         */
+        bool full() const {
+            return heap.size() == K;
+        }
+
+        /**
+         * Number of elements kept at most
+         */
+        static constexpr std::size_t capacity() {
+            return K;
+        }
+
+        /**
+         * Convert to string representation for display: the kept elements, best first
+         * Requires T to support operator<<
+         */
+        std::string toString() const {
+            if (empty()) {
+                return "No element!";
+            }
+
+            std::vector<T> elements = sorted();
+            std::ostringstream oss;
+            oss << '[';
+            for (std::size_t i = 0; i < elements.size(); ++i) {
+                oss << elements[i];
+                if (i + 1 < elements.size()) {
+                    oss << ',';
+                }
+            }
+            oss << ']';
+            return oss.str();
+        }
+};